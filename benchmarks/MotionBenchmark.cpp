@@ -0,0 +1,160 @@
+//
+// Created on 10/17/2026.
+//
+// Times MotionSystem::step, which integrates each chunk's MotionComponents in place, against the per-entity
+// integration it replaced, over the same bodies, and checks both end up in the same place.
+// Built with -DVAPE_BUILD_BENCHMARKS=ON.
+//
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <limits>
+#include <random>
+#include <Engine/ECS/ECS.hpp>
+#include <Components/MotionComponent.hpp>
+#include <Components/BoundaryComponent.hpp>
+#include <Systems/MotionSystem.hpp>
+
+namespace {
+    const float STEP_MS = 1000.f / 120.f;
+    const int WARMUP_STEPS = 20;
+    const int TIMED_STEPS = 100;
+    const int TIMED_RUNS = 5;
+
+    struct Body : public ECS::Entity {};
+
+    // The per-entity integration MotionSystem used before it worked a chunk at a time, kept as the reference
+    namespace Reference {
+        void decay(MotionComponent* motion) {
+            if (motion->friction != 0) {
+                if (motion->velocity.x > 0.f)
+                    motion->velocity.x -= motion->friction * motion->velocity.x;
+                else if (motion->velocity.x < 0.f)
+                    motion->velocity.x += -motion->friction * motion->velocity.x;
+
+                if (motion->velocity.y > 0.f)
+                    motion->velocity.y -= motion->friction * motion->velocity.y;
+                else if (motion->velocity.y < 0.f)
+                    motion->velocity.y += -motion->friction * motion->velocity.y;
+            }
+        }
+
+        void accelerate(MotionComponent* motion) {
+            float max = motion->maxVelocity;
+            if (max >= 0) {
+                float newX = motion->velocity.x + motion->acceleration.x;
+                if (newX > max) newX = max;
+                if (newX < -max) newX = -max;
+
+                float newY = motion->velocity.y + motion->acceleration.y;
+                if (newY > max) newY = max;
+                if (newY < -max) newY = -max;
+
+                motion->velocity.x = newX;
+                motion->velocity.y = newY;
+            }
+        }
+
+        void step(ECS::EntityManager& entities, float ms) {
+            // Unbounded movement
+            entities.view<MotionComponent>(ECS::componentMask<BoundaryComponent>()).each(
+                [&](ECS::Entity&, MotionComponent& motion) {
+                    accelerate(&motion);
+
+                    vec2 step = {motion.velocity.x * (ms / 1000), motion.velocity.y * (ms / 1000)};
+                    motion.position.x = motion.position.x + step.x;
+                    motion.position.y = motion.position.y + step.y;
+
+                    decay(&motion);
+                });
+
+            // Handle Boundaries
+            entities.view<MotionComponent, BoundaryComponent>().each(
+                [&](ECS::Entity&, MotionComponent& motion, BoundaryComponent& boundary) {
+                    accelerate(&motion);
+
+                    vec2 step = {motion.velocity.x * (ms / 1000), motion.velocity.y * (ms / 1000)};
+                    motion.position.x = std::min(std::max(motion.position.x + step.x, boundary.minX), boundary.maxX);
+                    motion.position.y = std::min(std::max(motion.position.y + step.y, boundary.minY), boundary.maxY);
+
+                    decay(&motion);
+                });
+        }
+    }
+
+    // Same bodies for the same seed: a quarter bounded to the screen, some with a speed cap or friction
+    void populate(ECS::EntityManager& entities, std::size_t count) {
+        std::mt19937 random(427);
+        std::uniform_real_distribution<float> position(0.f, 1200.f);
+        std::uniform_real_distribution<float> velocity(-400.f, 400.f);
+        std::uniform_real_distribution<float> acceleration(-20.f, 20.f);
+        for (std::size_t i = 0; i < count; ++i) {
+            auto& body = entities.addEntity<Body>();
+            auto* motion = body.addComponent<MotionComponent>();
+            motion->position = { position(random), position(random) };
+            motion->velocity = { velocity(random), velocity(random) };
+            motion->acceleration = { acceleration(random), acceleration(random) };
+            motion->maxVelocity = i % 3 == 0 ? 300.f : -1.f;
+            motion->friction = i % 5 == 0 ? 0.05f : 0.f;
+            if (i % 4 == 0)
+                body.addComponent<BoundaryComponent>(0.f, 1200.f, 0.f, 800.f);
+        }
+        entities.update(0.f);
+    }
+
+    // Best of a few runs, in us per step
+    template <typename Step> double time(ECS::EntityManager& entities, Step step) {
+        for (int i = 0; i < WARMUP_STEPS; ++i)
+            step(entities, STEP_MS);
+
+        double best = std::numeric_limits<double>::max();
+        for (int run = 0; run < TIMED_RUNS; ++run) {
+            auto start = std::chrono::steady_clock::now();
+            for (int i = 0; i < TIMED_STEPS; ++i)
+                step(entities, STEP_MS);
+            std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+            best = std::min(best, elapsed.count() / TIMED_STEPS);
+        }
+        return best;
+    }
+
+    // Entities are added in the same order to both managers, so they get the same ids
+    bool same(ECS::EntityManager& a, ECS::EntityManager& b) {
+        for (auto* entity : a.getEntities()) {
+            auto* other = b.getEntity<ECS::Entity>(entity->getId());
+            if (other == nullptr)
+                return false;
+            const auto* ma = entity->getComponent<MotionComponent>();
+            const auto* mb = other->getComponent<MotionComponent>();
+            if (ma->position.x != mb->position.x || ma->position.y != mb->position.y ||
+                    ma->velocity.x != mb->velocity.x || ma->velocity.y != mb->velocity.y)
+                return false;
+        }
+        return true;
+    }
+}
+
+int main() {
+    int status = 0;
+    std::printf("%8s %16s %18s %8s %s\n", "bodies", "per-entity (us)", "MotionSystem (us)", "speedup", "results");
+    for (std::size_t count : { 1000, 10000, 100000 }) {
+        ECS::EntityManager reference;
+        ECS::EntityManager batched;
+        populate(reference, count);
+        populate(batched, count);
+
+        double referenceUs = time(reference, Reference::step);
+        double batchedUs = time(batched, MotionSystem::step);
+        bool match = same(reference, batched);
+        if (!match)
+            status = 1;
+
+        std::printf("%8zu %16.1f %18.1f %7.2fx %s\n", count, referenceUs, batchedUs, referenceUs / batchedUs,
+                match ? "identical" : "DIFFERENT");
+
+        reference.clear();
+        batched.clear();
+    }
+    return status;
+}
@@ -5,22 +5,100 @@
 #ifndef VAPE_COLLISIONCOMPONENT_HPP
 #define VAPE_COLLISIONCOMPONENT_HPP
 
+#include <algorithm>
+#include <cstdint>
+#include <common.hpp>
 #include <Engine/ECS/Component.hpp>
 
-enum collidableType {
+enum class collidableType {
     none,
-    radius,
-    aabb,
-    complex,
-}; // I guess just pull the relevant data required from other components, mainly SpriteComponent?
+    radius, // Circle around the entity's position
+    aabb, // Axis aligned box around the entity's position
+    complex, // Tested by the entity's own routine, e.g. a boss' sprite outline
+};
+
+// What an entity is as far as collision response cares, picks the event buffer its collisions go to
+enum class CollisionClass : std::uint8_t {
+    Player,
+    Enemy,
+    Boss,
+    Clone,
+    FriendlyProjectile,
+    HostileProjectile,
+    Pickup,
+    Count
+};
+
+inline std::uint32_t collisionLayer(CollisionClass c) {
+    return 1u << (std::uint32_t)c;
+}
 
+// The classes a class is tested against, so e.g. friendly bullets are never tested against the player
+inline std::uint32_t collisionMask(CollisionClass c) {
+    switch (c) {
+        case CollisionClass::Player:
+            return collisionLayer(CollisionClass::Enemy) | collisionLayer(CollisionClass::HostileProjectile) |
+                   collisionLayer(CollisionClass::Pickup);
+        case CollisionClass::Enemy:
+            return collisionLayer(CollisionClass::Player) | collisionLayer(CollisionClass::FriendlyProjectile);
+        case CollisionClass::Boss:
+        case CollisionClass::Clone:
+            return collisionLayer(CollisionClass::FriendlyProjectile);
+        case CollisionClass::FriendlyProjectile:
+            return collisionLayer(CollisionClass::Enemy) | collisionLayer(CollisionClass::Boss) |
+                   collisionLayer(CollisionClass::Clone);
+        case CollisionClass::HostileProjectile:
+        case CollisionClass::Pickup:
+            return collisionLayer(CollisionClass::Player);
+        default:
+            return 0;
+    }
+}
+
+// Given the entity itself, and the other collider's position and bounding box
+using ComplexCollisionTest = bool (*)(const ECS::Entity& self, vec2 position, vec2 box);
+
+// Positioned by the entity's MotionComponent
 class CollisionComponent : public ECS::Component {
 public:
     collidableType type = collidableType::none;
-    const char* classname;
+    CollisionClass collisionClass = CollisionClass::Enemy;
+    std::uint32_t layer = collisionLayer(CollisionClass::Enemy); // Bit(s) of the classes this is
+    std::uint32_t mask = collisionMask(CollisionClass::Enemy); // Bits of the classes this can collide with
+
+    float radius = 0.f;
+    vec2 size = { 0.f, 0.f }; // Bounding box, the box for aabb and what complex tests are given about this collider
+    ComplexCollisionTest test = nullptr;
+
+    // Where the entity was when collisions were last detected, circles and boxes are swept from there
+    vec2 lastPosition = { 0.f, 0.f };
+    bool tested = false;
+
+    // Also resets layer and mask to the class' defaults
+    void setClass(CollisionClass c) {
+        collisionClass = c;
+        layer = collisionLayer(c);
+        mask = collisionMask(c);
+    }
+
+    // Circle of radius scale * the box's larger side. Two circles collide when either center is inside
+    // the other's circle, the same approximate check the old collides_with routines made.
+    void setRadius(vec2 box, float scale) {
+        type = collidableType::radius;
+        radius = std::max(box.x, box.y) * scale;
+        size = box;
+    }
+
+    void setBox(vec2 box) {
+        type = collidableType::aabb;
+        size = box;
+    }
 
-    template <typename T> void setClass() { // Uhh I really don't know if this will work as intended..
-        classname = typeid(T).name();
+    // box must contain everything test can collide with, it's used by the broadphase
+    void setComplex(ComplexCollisionTest test, vec2 box) {
+        type = collidableType::complex;
+        this->test = test;
+        size = box;
     }
 };
 
@@ -0,0 +1,49 @@
+//
+// Created on 10/17/2026.
+//
+// Every component type, in type id order. The ECS sizes its bitsets and component arrays from this list.
+// Only append new components, ids are saved in snapshots and must stay stable.
+//
+
+#ifndef VAPE_COMPONENTREGISTRY_HPP
+#define VAPE_COMPONENTREGISTRY_HPP
+
+#include <Engine/ECS/TypeList.hpp>
+
+class MotionComponent;
+class PhysicsComponent;
+class EffectComponent;
+class SpriteComponent;
+class TransformComponent;
+class MeshComponent;
+class TextureComponent;
+class HealthComponent;
+class BoundaryComponent;
+class EnemyComponent;
+class CollisionComponent;
+class PlayerComponent;
+class PickupComponent;
+class CullBoundsComponent;
+class LifetimeComponent;
+
+namespace ECS {
+    using RegisteredComponents = TypeList<
+        MotionComponent,
+        PhysicsComponent,
+        EffectComponent,
+        SpriteComponent,
+        TransformComponent,
+        MeshComponent,
+        TextureComponent,
+        HealthComponent,
+        BoundaryComponent,
+        EnemyComponent,
+        CollisionComponent,
+        PlayerComponent,
+        PickupComponent,
+        CullBoundsComponent,
+        LifetimeComponent
+    >;
+}
+
+#endif //VAPE_COMPONENTREGISTRY_HPP
@@ -0,0 +1,20 @@
+//
+// Created on 10/17/2026.
+//
+
+#ifndef VAPE_CULLBOUNDSCOMPONENT_HPP
+#define VAPE_CULLBOUNDSCOMPONENT_HPP
+
+#include <common.hpp>
+#include <Engine/ECS/Component.hpp>
+
+// CullingSystem destroys the entity once its bounding box is entirely outside the screen grown by margin
+class CullBoundsComponent : public ECS::Component {
+public:
+    vec2 size = { 0.f, 0.f }; // Bounding box, centered on MotionComponent::position
+    float margin = 0.f;
+
+    CullBoundsComponent(vec2 size, float margin) : size(size), margin(margin) {}
+};
+
+#endif //VAPE_CULLBOUNDSCOMPONENT_HPP
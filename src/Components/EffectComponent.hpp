@@ -38,6 +38,7 @@ namespace
 
 class EffectComponent : public ECS::Component {
 private:
+    ECS::ResourceOwnership ownership;
 
 public:
     GLuint vertex;
@@ -46,6 +47,11 @@ public:
 
     void release()
     {
+        if (!ownership.owns()) {
+            program = vertex = fragment = 0;
+            return;
+        }
+
         if (program != 0) {
             glDeleteProgram(program);
             program = 0;
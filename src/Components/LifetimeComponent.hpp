@@ -0,0 +1,18 @@
+//
+// Created on 10/17/2026.
+//
+
+#ifndef VAPE_LIFETIMECOMPONENT_HPP
+#define VAPE_LIFETIMECOMPONENT_HPP
+
+#include <Engine/ECS/Component.hpp>
+
+// CullingSystem destroys the entity once remaining runs out
+class LifetimeComponent : public ECS::Component {
+public:
+    float remaining = 0.f; // ms
+
+    explicit LifetimeComponent(float remaining) : remaining(remaining) {}
+};
+
+#endif //VAPE_LIFETIMECOMPONENT_HPP
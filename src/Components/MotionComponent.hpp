@@ -17,6 +17,29 @@ public:
     vec2 acceleration = {0,0};
     float maxVelocity = -1; // Negative = not checked
     float friction = 0.f;
+
+    // Where to draw the entity, between its position at the start of the last simulation step and the current one
+    vec2 renderPosition = {0,0};
+
+    // Called by the engine before every simulation step
+    void beginStep() {
+        previousPosition = position;
+        stepped = true;
+    }
+
+    // Called by the engine before drawing, alpha is how far into the next step the simulation is
+    void interpolate(float alpha) {
+        if (!stepped) {
+            renderPosition = position; // Added during the last step, nothing to interpolate from
+            return;
+        }
+        renderPosition.x = previousPosition.x + (position.x - previousPosition.x) * alpha;
+        renderPosition.y = previousPosition.y + (position.y - previousPosition.y) * alpha;
+    }
+
+private:
+    vec2 previousPosition = {0,0};
+    bool stepped = false;
 };
 
 #endif //VAPE_MOTIONCOMPONENT_HPP
\ No newline at end of file
@@ -18,6 +18,7 @@ private:
     GLuint vertexDataBuffer;
     GLuint* indexBuffers;
     bool completed;
+    ECS::ResourceOwnership ownership;
 
 public:
     bool initTexture(Texture* texture, float z = -0.02f) {
@@ -145,6 +146,13 @@ public:
     }
 
     void release() {
+        if (!ownership.owns()) {
+            vertexDataBuffer = 0;
+            indexBuffers = nullptr;
+            vao = 0;
+            return;
+        }
+
         if (vertexDataBuffer != 0){
             glDeleteBuffers(1, &vertexDataBuffer);
             vertexDataBuffer = 0;
@@ -10,12 +10,40 @@
 #define VAPE_TRANSFORMCOMPONENT_HPP
 
 class TransformComponent : public ECS::Component {
+private:
+    // Inputs out was last built from by set, dirty when out was built by hand (begin ... end) instead
+    vec2 m_position = { 0.f, 0.f };
+    vec2 m_scale = { 1.f, 1.f };
+    float m_radians = 0.f;
+    bool m_dirty = true;
+
 public:
     mat3 out;
 
+    // Sets out to translate(position) * scale(scale) * rotate(radians),
+    // only rebuilding the matrix when one of them changed since the last call
+    void set(vec2 position, vec2 scale, float radians)
+    {
+        if (!m_dirty && position.x == m_position.x && position.y == m_position.y &&
+            scale.x == m_scale.x && scale.y == m_scale.y && radians == m_radians)
+            return;
+
+        begin();
+        translate(position);
+        this->scale(scale);
+        rotate(radians);
+        end();
+
+        m_position = position;
+        m_scale = scale;
+        m_radians = radians;
+        m_dirty = false;
+    }
+
     void begin()
     {
         out = { { 1.f, 0.f, 0.f }, { 0.f, 1.f, 0.f}, { 0.f, 0.f, 1.f} };
+        m_dirty = true;
     }
 
     void scale(vec2 scale)
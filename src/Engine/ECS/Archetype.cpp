@@ -0,0 +1,136 @@
+//
+// Created on 10/17/2026.
+//
+
+#include "Archetype.hpp"
+
+namespace ECS {
+    Archetype::Archetype(ComponentBitSet signature) : signature(signature) {
+        columnIndex.fill(-1);
+        for (ComponentId id = 0; id < maxComponents; ++id) {
+            if (signature[id]) {
+                columnIndex[id] = (int)types.size();
+                types.push_back(id);
+            }
+        }
+    }
+
+    unsigned char* Archetype::address(ArchetypeLocation location, std::size_t column) const {
+        auto* info = componentInfos()[types[column]];
+        return chunks[location.chunk]->columns[column].get() + location.row * info->size;
+    }
+
+    // Reserves a row at the end of the last chunk, adding a chunk when it's full
+    ArchetypeLocation Archetype::allocate(Entity* entity) {
+        if (chunks.empty() || chunks.back()->full()) {
+            std::unique_ptr<ArchetypeChunk> chunk(new ArchetypeChunk());
+            for (auto id : types) {
+                std::unique_ptr<unsigned char[]> column(new unsigned char[componentInfos()[id]->size * chunkCapacity]);
+                chunk->columns.emplace_back(std::move(column));
+            }
+            chunks.emplace_back(std::move(chunk));
+        }
+        ArchetypeLocation location = { chunks.size() - 1, chunks.back()->count };
+        bind(entity, location);
+        chunks.back()->count++;
+        count++;
+        return location;
+    }
+
+    Component* Archetype::construct(ArchetypeLocation location, ComponentId id, Component* src) {
+        auto column = (std::size_t)columnIndex[id];
+        return componentInfos()[id]->moveInto(address(location, column), src);
+    }
+
+    void Archetype::bind(Entity* entity, ArchetypeLocation location) {
+        chunks[location.chunk]->entities[location.row] = entity;
+        entity->archetype = this;
+        entity->location = location;
+    }
+
+    // Destroys the row's components, then moves the last row into the hole to keep chunks packed
+    void Archetype::release(ArchetypeLocation location) {
+        Entity* removed = chunks[location.chunk]->entities[location.row];
+        for (auto id : types)
+            componentInfos()[id]->destroy(removed->componentArray[id]);
+
+        ArchetypeLocation last = { chunks.size() - 1, chunks.back()->count - 1 };
+        if (last.chunk != location.chunk || last.row != location.row) {
+            Entity* moved = chunks[last.chunk]->entities[last.row];
+            for (auto id : types) {
+                Component* src = moved->componentArray[id];
+                moved->componentArray[id] = construct(location, id, src);
+                componentInfos()[id]->destroy(src);
+            }
+            bind(moved, location);
+        }
+
+        chunks.back()->count--;
+        count--;
+        if (chunks.back()->count == 0)
+            chunks.pop_back();
+    }
+
+    Archetype& ArchetypeStore::getArchetype(const ComponentBitSet& signature) {
+        auto it = bySignature.find(signature);
+        if (it != bySignature.end())
+            return *it->second;
+
+        std::unique_ptr<Archetype> archetype(new Archetype(signature));
+        Archetype* ptr = archetype.get();
+        archetypes.emplace_back(std::move(archetype));
+        bySignature.emplace(signature, ptr);
+        return *ptr;
+    }
+
+    void ArchetypeStore::commit(Entity& entity) {
+        if (entity.archetype != nullptr)
+            return;
+
+        Archetype& archetype = getArchetype(entity.componentBitSet);
+        ArchetypeLocation location = archetype.allocate(&entity);
+        for (auto id : archetype.types)
+            entity.componentArray[id] = archetype.construct(location, id, entity.componentArray[id]);
+
+        // Frees the staged, now moved-from, components
+        entity.components.clear();
+    }
+
+    Component* ArchetypeStore::attach(Entity& entity, ComponentId id, Component* src) {
+        Archetype& from = *entity.archetype;
+        ArchetypeLocation fromLocation = entity.location;
+
+        // Replacing an existing component keeps the entity where it is
+        if (entity.componentBitSet[id]) {
+            componentInfos()[id]->destroy(entity.componentArray[id]);
+            entity.componentArray[id] = from.construct(fromLocation, id, src);
+            return entity.componentArray[id];
+        }
+
+        ComponentBitSet signature = entity.componentBitSet;
+        signature[id] = true;
+        Archetype& to = getArchetype(signature);
+
+        ComponentArray moved{};
+        ArchetypeLocation toLocation = to.allocate(&entity);
+        for (auto type : from.types)
+            moved[type] = to.construct(toLocation, type, entity.componentArray[type]);
+        moved[id] = to.construct(toLocation, id, src);
+
+        // Moved-from components are destroyed by release, which may move another entity into the old row
+        from.release(fromLocation);
+
+        for (auto type : to.types)
+            entity.componentArray[type] = moved[type];
+        entity.componentBitSet[id] = true;
+        to.bind(&entity, toLocation);
+        return entity.componentArray[id];
+    }
+
+    void ArchetypeStore::remove(Entity& entity) {
+        if (entity.archetype == nullptr)
+            return;
+        entity.archetype->release(entity.location);
+        entity.archetype = nullptr;
+    }
+}
@@ -0,0 +1,149 @@
+//
+// Created on 10/17/2026.
+//
+// Archetype (chunked) component storage.
+// Every entity with the same ComponentBitSet signature lives in the same Archetype,
+// and each component type of that archetype is stored contiguously inside fixed size chunks.
+// Components only move at sync points (EntityManager::update) or when a component is added to
+// an entity that is already stored, so pointers from getComponent are stable within a frame.
+//
+
+#ifndef VAPE_ARCHETYPE_HPP
+#define VAPE_ARCHETYPE_HPP
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <tuple>
+#include <vector>
+#include <unordered_map>
+#include "Entity.hpp"
+
+namespace ECS {
+    class Entity;
+    class Archetype;
+    class ArchetypeStore;
+
+    // Rows per chunk. Chunks never reallocate, so a component's address only changes when its row moves.
+    constexpr std::size_t chunkCapacity = 128;
+
+    // Bitset with the bits of each of Ts set
+    template <typename... Ts> ComponentBitSet componentMask() {
+        ComponentBitSet mask;
+        std::size_t ids[] = { 0, getComponentTypeId<Ts>()... };
+        for (std::size_t i = 1; i < sizeof(ids) / sizeof(ids[0]); ++i)
+            mask[ids[i]] = true;
+        return mask;
+    }
+
+    // Fixed capacity block of rows, one contiguous array per component type of the archetype
+    class ArchetypeChunk {
+        friend class Archetype;
+    private:
+        std::size_t count = 0;
+        std::vector<std::unique_ptr<unsigned char[]>> columns;
+        std::array<Entity*, chunkCapacity> entities{};
+    public:
+        std::size_t size() const { return count; }
+        bool full() const { return count == chunkCapacity; }
+        Entity* entity(std::size_t row) const { return entities[row]; }
+
+        template <typename T> T* column(std::size_t index) const {
+            return reinterpret_cast<T*>(columns[index].get());
+        }
+    };
+
+    class Archetype {
+        friend class ArchetypeStore;
+    private:
+        ComponentBitSet signature;
+        std::vector<ComponentId> types; // Component typeIds, ascending
+        std::array<int, maxComponents> columnIndex; // typeId -> column, -1 if not part of the archetype
+        std::vector<std::unique_ptr<ArchetypeChunk>> chunks;
+        std::size_t count = 0;
+
+        ArchetypeLocation allocate(Entity* entity);
+        Component* construct(ArchetypeLocation location, ComponentId id, Component* src);
+        void release(ArchetypeLocation location);
+        void bind(Entity* entity, ArchetypeLocation location);
+        unsigned char* address(ArchetypeLocation location, std::size_t column) const;
+
+    public:
+        explicit Archetype(ComponentBitSet signature);
+
+        const ComponentBitSet& getSignature() const { return signature; }
+        const std::vector<std::unique_ptr<ArchetypeChunk>>& getChunks() const { return chunks; }
+        std::size_t size() const { return count; }
+        int getColumn(ComponentId id) const { return columnIndex[id]; }
+    };
+
+    template <std::size_t... Is> struct IndexSequence {};
+    template <std::size_t N, std::size_t... Is> struct MakeIndexSequence : MakeIndexSequence<N - 1, N - 1, Is...> {};
+    template <std::size_t... Is> struct MakeIndexSequence<0, Is...> { using type = IndexSequence<Is...>; };
+
+    // Iterates every stored entity having all of Ts (and none of the excluded components),
+    // handing fn(Entity&, Ts&...) one chunk at a time as a linear sweep.
+    // Adding entities or components from inside fn is not allowed.
+    template <typename... Ts> class View {
+    private:
+        std::vector<const Archetype*> archetypes;
+
+        template <typename Fn, std::size_t... Is>
+        void eachInChunk(const Archetype& archetype, const ArchetypeChunk& chunk, Fn& fn, IndexSequence<Is...>) const {
+            std::tuple<Ts*...> columns(chunk.template column<Ts>((std::size_t)archetype.getColumn(getComponentTypeId<Ts>()))...);
+            for (std::size_t row = 0; row < chunk.size(); ++row)
+                fn(*chunk.entity(row), std::get<Is>(columns)[row]...);
+        }
+    public:
+        explicit View(std::vector<const Archetype*> archetypes) : archetypes(std::move(archetypes)) {}
+
+        template <typename Fn> void each(Fn fn) const {
+            for (auto* archetype : archetypes)
+                for (auto& chunk : archetype->getChunks())
+                    eachInChunk(*archetype, *chunk, fn, typename MakeIndexSequence<sizeof...(Ts)>::type{});
+        }
+
+        // Hands fn(std::size_t count, Ts*...) each chunk's columns, at most chunkCapacity rows at a time
+        template <typename Fn> void eachChunk(Fn fn) const {
+            for (auto* archetype : archetypes)
+                for (auto& chunk : archetype->getChunks())
+                    fn(chunk->size(), chunk->template column<Ts>((std::size_t)archetype->getColumn(getComponentTypeId<Ts>()))...);
+        }
+
+        std::size_t size() const {
+            std::size_t total = 0;
+            for (auto* archetype : archetypes) total += archetype->size();
+            return total;
+        }
+    };
+
+    class ArchetypeStore {
+    private:
+        std::vector<std::unique_ptr<Archetype>> archetypes;
+        std::unordered_map<ComponentBitSet, Archetype*> bySignature;
+
+        Archetype& getArchetype(const ComponentBitSet& signature);
+    public:
+        // Moves an entity's heap allocated (staged) components into its archetype
+        void commit(Entity& entity);
+
+        // Moves a stored entity into the archetype with the added component, src is moved from
+        Component* attach(Entity& entity, ComponentId id, Component* src);
+
+        // Destroys an entity's components, filling its row with the archetype's last row
+        void remove(Entity& entity);
+
+        template <typename... Ts> View<Ts...> view(const ComponentBitSet& exclude = ComponentBitSet()) const {
+            ComponentBitSet include = componentMask<Ts...>();
+            std::vector<const Archetype*> matching;
+            for (auto& archetype : archetypes) {
+                const auto& signature = archetype->getSignature();
+                if ((signature & include) == include && (signature & exclude).none())
+                    matching.push_back(archetype.get());
+            }
+            return View<Ts...>(std::move(matching));
+        }
+    };
+}
+
+#endif //VAPE_ARCHETYPE_HPP
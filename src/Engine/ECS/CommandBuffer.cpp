@@ -0,0 +1,57 @@
+//
+// Created on 10/17/2026.
+//
+
+#include "CommandBuffer.hpp"
+#include "EntityManager.hpp"
+
+namespace ECS {
+    EntityId CommandBuffer::reserve() {
+        auto index = manager.acquireSlot();
+        return makeEntityId(index, manager.slots[index].generation);
+    }
+
+    EntityPools& CommandBuffer::pools() {
+        return manager.pools;
+    }
+
+    void CommandBuffer::flush() {
+        // Commands recorded while flushing (e.g. from an entity's destroy) are kept for the next flush
+        auto spawned = std::move(spawns);
+        auto added = std::move(additions);
+        auto destroyed = std::move(destroys);
+        spawns.clear();
+        additions.clear();
+        destroys.clear();
+
+        for (auto& e : spawned)
+            manager.insert(std::move(e));
+
+        for (auto& addition : added) {
+            if (auto* e = manager.getEntity<Entity>(addition.first))
+                addition.second(*e);
+        }
+
+        for (auto id : destroyed) {
+            auto* e = manager.getEntity<Entity>(id);
+            if (e != nullptr && e->isActive())
+                e->destroy();
+        }
+    }
+
+    void CommandBuffer::clear() {
+        // Spawns were already initialized, so they're destroyed to release their resources.
+        // Destroying one may record more spawns, which are dropped the same way.
+        while (!spawns.empty()) {
+            auto spawned = std::move(spawns);
+            spawns.clear();
+            for (auto& e : spawned) {
+                if (e->isActive())
+                    e->destroy();
+                manager.freeSlot(entityIndex(e->getId()));
+            }
+        }
+        additions.clear();
+        destroys.clear();
+    }
+}
@@ -0,0 +1,64 @@
+//
+// Created on 10/17/2026.
+//
+// Structural changes (spawns, destroys, component adds) recorded during a frame
+// and applied together by EntityManager::update, so nothing is inserted or removed while iterating.
+//
+
+#ifndef VAPE_COMMANDBUFFER_HPP
+#define VAPE_COMMANDBUFFER_HPP
+
+#include <functional>
+#include <memory>
+#include <utility>
+#include <vector>
+#include "Entity.hpp"
+#include "EntityPool.hpp"
+
+namespace ECS {
+    class EntityManager;
+
+    class CommandBuffer {
+        friend class EntityManager;
+    private:
+        EntityManager& manager;
+        std::vector<EntityPtr> spawns;
+        std::vector<std::pair<EntityId, std::function<void(Entity&)>>> additions;
+        std::vector<EntityId> destroys;
+
+        EntityId reserve();
+        EntityPools& pools();
+
+        // Applies spawns, then component adds, then destroys
+        void flush();
+
+        // Drops every recorded command, destroying unflushed spawns and freeing their reserved ids
+        void clear();
+    public:
+        explicit CommandBuffer(EntityManager& manager) : manager(manager) {}
+
+        // The entity is constructed now so it can be initialized, but is only added to the manager,
+        // and its id only becomes valid, at the next flush
+        template <typename T, typename... TArgs> T& spawn(TArgs&&... mArgs) {
+            EntityPtr owner;
+            T* e = pools().create<T>(owner, std::forward<TArgs>(mArgs)...);
+            e->id = reserve();
+            spawns.emplace_back(std::move(owner));
+            return *e;
+        }
+
+        // Like spawn, but copies T's prefab (see EntityManager::instantiate) so T::init is skipped.
+        // onInstantiate is called now, before the copy is added. Defined in EntityManager.hpp.
+        template <typename T> T& instantiate();
+
+        template <typename T, typename... TArgs> void addComponent(EntityId id, TArgs... mArgs) {
+            additions.emplace_back(id, [=](Entity& e) { e.addComponent<T>(mArgs...); });
+        }
+
+        void destroy(EntityId id) { destroys.push_back(id); }
+
+        bool empty() const { return spawns.empty() && additions.empty() && destroys.empty(); }
+    };
+}
+
+#endif //VAPE_COMMANDBUFFER_HPP
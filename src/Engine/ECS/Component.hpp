@@ -10,6 +10,21 @@
 namespace ECS {
     class Entity;
 
+    // Tracks whether a component owns the GPU resources it refers to. Copies (prefab instances)
+    // share the original's resources, so only the original releases them.
+    class ResourceOwnership {
+    private:
+        bool owner = true;
+    public:
+        ResourceOwnership() = default;
+        ResourceOwnership(const ResourceOwnership&) : owner(false) {}
+        ResourceOwnership(ResourceOwnership&& other) noexcept : owner(other.owner) {}
+        ResourceOwnership& operator=(const ResourceOwnership&) { owner = false; return *this; }
+        ResourceOwnership& operator=(ResourceOwnership&& other) noexcept { owner = other.owner; return *this; }
+
+        bool owns() const { return owner; }
+    };
+
     class Component {
     public:
         // Owner
@@ -10,6 +10,8 @@
 
 #include "Entity.hpp"
 #include "EntityManager.hpp"
+#include "Archetype.hpp"
+#include "CommandBuffer.hpp"
 #include "Component.hpp"
 #include "System.hpp"
 #include "SystemManager.hpp"
@@ -0,0 +1,39 @@
+//
+// Created on 10/17/2026.
+//
+
+#include <stdexcept>
+#include "Entity.hpp"
+#include "Archetype.hpp"
+#include "EntityManager.hpp"
+
+namespace ECS {
+    Component* Entity::attachComponent(ComponentId id, Component* src) {
+        return store->attach(*this, id, src);
+    }
+
+    Entity::~Entity() {
+        if (store != nullptr)
+            store->remove(*this);
+    }
+
+    Entity::Entity(const Entity& other) : active(other.active), componentBitSet(other.componentBitSet) {
+        for (ComponentId id = 0; id < maxComponents; ++id) {
+            if (!other.componentBitSet[id])
+                continue;
+            auto* info = componentInfos()[id];
+            if (info->clone == nullptr)
+                throw std::runtime_error("Entity has a component that can't be copied");
+
+            std::unique_ptr<Component> component{ info->clone(other.componentArray[id]) };
+            component->entity = this;
+            componentArray[id] = component.get();
+            components.emplace_back(std::move(component));
+        }
+    }
+
+    void Entity::componentAdded() {
+        if (manager != nullptr)
+            manager->refreshQueries(*this);
+    }
+}
@@ -8,54 +8,128 @@
 #include <algorithm>
 #include <common.hpp>
 #include <array>
+#include <new>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
 
 #ifndef VAPE_ENTITY_H
 #define VAPE_ENTITY_H
 
 #include "Component.hpp"
+#include "TypeList.hpp"
+#include <Components/ComponentRegistry.hpp>
 
 namespace ECS {
     class Component;
     using ComponentId = std::size_t;
 
-    // Returns a unique, incremeneted Id
-    inline ComponentId getComponentTypeId() {
-        static ComponentId lastId = 0;
-        return lastId++;
-    };
-
-    // Returns a unique id for each type T of component;
-    template <typename T> inline ComponentId getComponentTypeId() noexcept {
-        static ComponentId typeId = getComponentTypeId();
-        return typeId;
+    // Returns the id of component type T, its position in RegisteredComponents. Known at compile time and stable across runs.
+    template <typename T> constexpr ComponentId getComponentTypeId() noexcept {
+        return TypeIndex<T, RegisteredComponents>::value;
     }
 
-    using EntityId = std::size_t;
+    // Entity handle: slot index in the low 32 bits, slot generation in the high 32 bits.
+    // A handle goes stale once its slot is freed, even if the slot is reused.
+    using EntityId = std::uint64_t;
 
-    constexpr std::size_t maxComponents = 32;
+    inline std::uint32_t entityIndex(EntityId id) { return (std::uint32_t)(id & 0xFFFFFFFFu); }
+    inline std::uint32_t entityGeneration(EntityId id) { return (std::uint32_t)(id >> 32u); }
+    inline EntityId makeEntityId(std::uint32_t index, std::uint32_t generation) {
+        return ((EntityId)generation << 32u) | index;
+    }
+
+    constexpr std::size_t maxComponents = RegisteredComponents::size;
 
     using ComponentBitSet = std::bitset<maxComponents>;
     using ComponentArray = std::array<Component*, maxComponents>;
     using ComponentPtrArray = std::array<std::unique_ptr<Component>, maxComponents>;
 
+    // Type-erased operations needed to move components into archetype storage, and to copy them from prefabs
+    struct ComponentInfo {
+        std::size_t size;
+        Component* (*moveInto)(void* dst, Component* src);
+        void (*destroy)(Component* component);
+        Component* (*clone)(const Component* src); // nullptr if the component can't be copied
+
+        template <typename T> static const ComponentInfo& of() {
+            static_assert(alignof(T) <= alignof(std::max_align_t), "Over-aligned components are not supported");
+            static const ComponentInfo info = {
+                sizeof(T), &moveComponent<T>, &destroyComponent<T>, cloner<T>(std::is_copy_constructible<T>())
+            };
+            return info;
+        }
+
+    private:
+        template <typename T> static Component* cloneComponent(const Component* src) {
+            return new T(*static_cast<const T*>(src));
+        }
+        template <typename T> static Component* (*cloner(std::true_type))(const Component*) { return &cloneComponent<T>; }
+        template <typename T> static Component* (*cloner(std::false_type))(const Component*) { return nullptr; }
+
+        template <typename T> static Component* moveComponent(void* dst, Component* src) {
+            return new (dst) T(std::move(*static_cast<T*>(src)));
+        }
+        template <typename T> static void destroyComponent(Component* component) {
+            static_cast<T*>(component)->~T();
+        }
+    };
+
+    // Component infos indexed by typeId, filled in the first time a type is added to an entity
+    inline std::array<const ComponentInfo*, maxComponents>& componentInfos() {
+        static std::array<const ComponentInfo*, maxComponents> infos{};
+        return infos;
+    }
+
+    class Archetype;
+    class ArchetypeStore;
+    class EntityManager;
+
+    // Where an entity's components live within its archetype
+    struct ArchetypeLocation {
+        std::size_t chunk;
+        std::size_t row;
+    };
+
 
     class Entity {
         friend class EntityManager;
+        friend class Archetype;
+        friend class ArchetypeStore;
+        friend class CommandBuffer;
     private:
         EntityId id;
         bool active = true;
 
-        std::vector<std::unique_ptr<Component>> components; // Component pointers
+        std::vector<std::unique_ptr<Component>> components; // Staged component pointers, until moved into an archetype
 
         ComponentArray componentArray{}; // Components indexed by typeId
         ComponentBitSet componentBitSet; // Quick True/False lookup for if has component;
+
+        EntityManager* manager = nullptr;
+        ArchetypeStore* store = nullptr; // Set by the owning EntityManager
+        Archetype* archetype = nullptr; // nullptr while components are still staged
+        ArchetypeLocation location{};
+
+        Component* attachComponent(ComponentId id, Component* src);
+        void componentAdded(); // Updates the manager's query lists
+    protected:
+        // Copies the other entity's components, for instantiating prefabs. The copy starts out unmanaged,
+        // with its components staged, like a newly constructed entity.
+        Entity(const Entity& other);
     public:
+        Entity() = default;
+        Entity& operator=(const Entity&) = delete;
+        virtual ~Entity();
+
         EntityId getId() const { return id; }
 
         virtual void update(float ms) {};
         virtual void draw(const mat3& projection) {};
         virtual void destroy() { active = false; };
-        virtual void collideWith(const char* typeName, const Entity& other) {};
+
+        // Called on each copy of a prefab, for per-instance setup that init would otherwise do
+        virtual void onInstantiate() {};
 
         bool isActive() const { return active; };
 
@@ -63,14 +137,27 @@ namespace ECS {
             return componentBitSet[getComponentTypeId<T>()];
         };
 
+        // Components are heap allocated until the entity's EntityManager moves them into archetype storage
+        // at its next update. Adding a component after that moves the entity into a new archetype,
+        // invalidating previously returned component pointers.
         template <typename T, typename... TArgs> T* addComponent(TArgs&&... mArgs) {
-            T* component(new T(std::forward<TArgs>(mArgs)...));
+            ComponentId id = getComponentTypeId<T>();
+            componentInfos()[id] = &ComponentInfo::of<T>();
+
+            T* component;
+            if (archetype == nullptr) {
+                component = new T(std::forward<TArgs>(mArgs)...);
+                std::unique_ptr<Component> uPtr{ component };
+                components.emplace_back((std::move(uPtr)));
+
+                componentArray[id] = component;
+                componentBitSet[id] = true;
+            } else {
+                T staged(std::forward<TArgs>(mArgs)...);
+                component = static_cast<T*>(attachComponent(id, &staged));
+            }
             component->entity = this;
-            std::unique_ptr<Component> uPtr{ component };
-            components.emplace_back((std::move(uPtr)));
-
-            componentArray[getComponentTypeId<T>()] = component;
-            componentBitSet[getComponentTypeId<T>()] = true;
+            componentAdded();
 
             component->init();
 
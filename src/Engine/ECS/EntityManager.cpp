@@ -6,20 +6,150 @@
 #include "EntityManager.hpp"
 
 namespace ECS {
+    namespace {
+        constexpr std::size_t npos = (std::size_t)-1;
+    }
+
+    std::uint32_t EntityManager::acquireSlot() {
+        if (!freeSlots.empty()) {
+            auto index = freeSlots.back();
+            freeSlots.pop_back();
+            return index;
+        }
+        slots.emplace_back();
+        return (std::uint32_t)(slots.size() - 1);
+    }
+
+    // Returns an empty (reserved) slot to the free list, invalidating its handles
+    void EntityManager::freeSlot(std::uint32_t index) {
+        slots[index].generation++;
+        freeSlots.push_back(index);
+    }
+
+    // Fills the slot reserved for the entity's id
+    void EntityManager::insert(EntityPtr e) {
+        Slot& slot = slots[entityIndex(e->id)];
+        e->manager = this;
+        e->store = &archetypes;
+        slot.denseIndex = entities.size();
+        entities.push_back(e.get());
+        pending.push_back(e.get());
+        slot.entity = std::move(e);
+        refreshQueries(*slot.entity);
+    }
+
+    Entity& EntityManager::addPrepared(EntityPtr e) {
+        Entity& entity = *e;
+        auto index = acquireSlot();
+        entity.id = makeEntityId(index, slots[index].generation);
+        insert(std::move(e));
+        entity.onInstantiate();
+        return entity;
+    }
+
+    // Destroys the slot's entity, swap-removing it from the dense array, and invalidates its handles
+    void EntityManager::releaseSlot(std::uint32_t index) {
+        Slot& slot = slots[index];
+        leaveQueries(*slot.entity);
+
+        std::size_t dense = slot.denseIndex;
+        Entity* last = entities.back();
+        entities[dense] = last;
+        slots[entityIndex(last->id)].denseIndex = dense;
+        entities.pop_back();
+
+        slot.entity.reset();
+        freeSlot(index);
+    }
+
+    const std::vector<Entity*>& EntityManager::query(const ComponentBitSet& mask) {
+        auto it = queryByMask.find(mask);
+        if (it != queryByMask.end())
+            return it->second->entities;
+
+        std::unique_ptr<Query> query(new Query());
+        query->mask = mask;
+        query->positions.assign(slots.size(), npos);
+        for (auto* e : entities) {
+            if ((e->componentBitSet & mask) == mask) {
+                query->positions[entityIndex(e->id)] = query->entities.size();
+                query->entities.push_back(e);
+            }
+        }
+
+        Query* ptr = query.get();
+        queries.emplace_back(std::move(query));
+        queryByMask.emplace(mask, ptr);
+        return ptr->entities;
+    }
+
+    // Adds the entity to any query it now matches
+    void EntityManager::refreshQueries(Entity& entity) {
+        auto index = entityIndex(entity.id);
+        for (auto& query : queries) {
+            if (query->positions.size() <= index)
+                query->positions.resize(slots.size(), npos);
+            if (query->positions[index] == npos && (entity.componentBitSet & query->mask) == query->mask) {
+                query->positions[index] = query->entities.size();
+                query->entities.push_back(&entity);
+            }
+        }
+    }
+
+    // Swap-removes the entity from every query it belongs to
+    void EntityManager::leaveQueries(Entity& entity) {
+        auto index = entityIndex(entity.id);
+        for (auto& query : queries) {
+            if (query->positions.size() <= index || query->positions[index] == npos)
+                continue;
+            std::size_t position = query->positions[index];
+            Entity* last = query->entities.back();
+            query->entities[position] = last;
+            query->positions[entityIndex(last->id)] = position;
+            query->entities.pop_back();
+            query->positions[index] = npos;
+        }
+    }
+
+    // Moves the components of entities added since the last update into archetype storage
+    void EntityManager::commitPending() {
+        for (auto* e : pending) {
+            if (e->isActive())
+                archetypes.commit(*e);
+        }
+        pending.clear();
+    }
+
+    // Sync point: applies deferred commands, moves new entities into archetype storage,
+    // then removes inactive entities in a single compaction pass
     void EntityManager::update(float ms) {
+        commands.flush();
+        commitPending();
         {
-            auto it = entities.begin();
-            while (it != entities.end()) {
-                // TODO it->second->update(ms);
-                if (!it->second->isActive())
-                    it = entities.erase(it);
+            std::size_t i = 0;
+            while (i < entities.size()) {
+                // TODO entities[i]->update(ms);
+                if (!entities[i]->isActive())
+                    releaseSlot(entityIndex(entities[i]->id)); // Moves the last entity into i
                 else
-                    it++;
+                    i++;
             }
         }
     }
 
     void EntityManager::draw(const mat3 &projection) {
-        for (auto & e : entities) e.second->draw(projection);
+        for (auto* e : entities) e->draw(projection);
+    }
+
+    void EntityManager::clear() {
+        for (auto* e : entities) {
+            if (e->isActive())
+                e->destroy();
+        }
+        // After the destroys, which can still record spawns
+        commands.clear();
+        pending.clear();
+        while (!entities.empty())
+            releaseSlot(entityIndex(entities.back()->id));
     }
-}
\ No newline at end of file
+}
@@ -5,43 +5,152 @@
 #ifndef VAPE_ENTITYMANAGER_HPP
 #define VAPE_ENTITYMANAGER_HPP
 
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
 #include <unordered_map>
 #include "Entity.hpp"
+#include "Archetype.hpp"
+#include "CommandBuffer.hpp"
+#include "EntityPool.hpp"
 
 namespace ECS {
     class EntityManager {
+        friend class Entity;
+        friend class CommandBuffer;
     private:
-        EntityId idCounter;
-        std::unordered_map<EntityId, std::unique_ptr<Entity>> entities;
+        struct Slot {
+            EntityPtr entity;
+            std::uint32_t generation = 0;
+            std::size_t denseIndex = 0; // Position in entities while occupied
+        };
+
+        // Entities matching a component mask, kept up to date as components are added and entities removed
+        struct Query {
+            ComponentBitSet mask;
+            std::vector<Entity*> entities;
+            std::vector<std::size_t> positions; // Slot index -> position in entities, npos if not a member
+        };
+
+        EntityPools pools; // Declared first, outliving every entity allocated from it
+        ArchetypeStore archetypes; // Declared before slots, entities remove themselves from it on destruction
+        std::vector<Slot> slots; // Indexed by entityIndex(id)
+        std::vector<std::uint32_t> freeSlots;
+        std::vector<Entity*> entities; // Densely packed live entities, in no particular order
+        std::vector<Entity*> pending; // Entities whose components are still staged
+        std::vector<std::unique_ptr<Query>> queries;
+        std::unordered_map<ComponentBitSet, Query*> queryByMask;
+        CommandBuffer commands{ *this };
+        // Initialized templates, indexed by EntityTypeId. They're never updated, drawn or destroyed,
+        // and live as long as the GL context, so their shared resources stay valid across states.
+        std::vector<EntityPtr> prefabs;
+
+        void commitPending();
+        void refreshQueries(Entity& entity);
+        void leaveQueries(Entity& entity);
+        std::uint32_t acquireSlot();
+        void freeSlot(std::uint32_t index);
+        void releaseSlot(std::uint32_t index);
+        void insert(EntityPtr e);
 
     public:
         void update(float ms);
         void draw(const mat3& projection);
 
+        // Adds the entity immediately. Use getCommands().spawn while iterating entities or from inside systems.
         template <typename T, typename... TArgs> T& addEntity(TArgs&&... mArgs) {
-            T* e(new T(std::forward<TArgs>(mArgs)...));
-            auto id = idCounter++;
-            e->id = id;
-            std::unique_ptr<Entity> uPtr{ e };
-            entities.emplace(id, std::move(uPtr));
+            EntityPtr owner;
+            T* e = pools.create<T>(owner, std::forward<TArgs>(mArgs)...);
+            auto index = acquireSlot();
+            e->id = makeEntityId(index, slots[index].generation);
+            insert(std::move(owner));
             return *e;
         };
 
-        template <typename T> T& getEntity(EntityId id) { return *(entities[id]); }
+        // The initialized template instantiate<T> copies from, created and init'ed on first use
+        template <typename T> T& getPrefab() {
+            auto typeId = getEntityTypeId<T>();
+            if (prefabs.size() <= typeId)
+                prefabs.resize(typeId + 1);
+            if (!prefabs[typeId]) {
+                T* prefab = new T();
+                prefabs[typeId] = EntityPtr(prefab);
+                if (!prefab->init()) {
+                    prefabs[typeId].reset();
+                    throw std::runtime_error("Failed to initialize prefab");
+                }
+            }
+            return *static_cast<T*>(prefabs[typeId].get());
+        }
+
+        // Adds a copy of T's prefab. Component data is copied while GPU resources (shaders, buffers)
+        // are shared with the prefab, so spawning skips T::init.
+        template <typename T> T& instantiate() {
+            return static_cast<T&>(addPrepared(prepare<T>()));
+        }
+
+        // A copy of T's prefab that isn't added yet, for building entities ahead of time. Until it's handed to
+        // addPrepared it isn't updated, drawn or part of any query.
+        template <typename T> EntityPtr prepare() {
+            T& prefab = getPrefab<T>();
+            EntityPtr owner;
+            pools.create<T>(owner, static_cast<const T&>(prefab));
+            return owner;
+        }
 
-        void removeEntity(EntityId id) { entities.erase(id); }
+        // Adds an entity made by prepare
+        Entity& addPrepared(EntityPtr e);
 
-        // TODO getter to just get ones with specific components?
-        std::unordered_map<EntityId, std::unique_ptr<Entity>> * getEntities() { return &entities; }
+        // Deferred structural changes, applied at the start of the next update
+        CommandBuffer& getCommands() { return commands; }
 
-        void clear() {
-            for (auto& entity : entities) {
-                if (entity.second->isActive())
-                    entity.second->destroy();
-            }
-            entities.clear();
+        // Slot usage and high-water marks of each entity type's pool
+        std::vector<SlabPoolStats> getPoolStats() const { return pools.getStats(); }
+
+        // O(1) check that the handle's entity has not been removed
+        bool isValid(EntityId id) const {
+            auto index = entityIndex(id);
+            return index < slots.size() && slots[index].entity && slots[index].generation == entityGeneration(id);
+        }
+
+        // nullptr if the handle is stale
+        template <typename T> T* getEntity(EntityId id) {
+            return isValid(id) ? static_cast<T*>(slots[entityIndex(id)].entity.get()) : nullptr;
+        }
+
+        void removeEntity(EntityId id) {
+            if (!isValid(id))
+                return;
+            auto* e = slots[entityIndex(id)].entity.get();
+            pending.erase(std::remove(pending.begin(), pending.end(), e), pending.end());
+            releaseSlot(entityIndex(id));
+        }
+
+        // Entities having all of Ts and none of the excluded components. Entities added this frame are not included
+        // until the next update.
+        template <typename... Ts> View<Ts...> view(const ComponentBitSet& exclude = ComponentBitSet()) const {
+            return archetypes.view<Ts...>(exclude);
         }
+
+        const std::vector<Entity*>& getEntities() const { return entities; }
+
+        // Entities having every component in mask, including inactive ones until the next update.
+        // The first call for a mask scans all entities, after which the list is maintained incrementally.
+        const std::vector<Entity*>& query(const ComponentBitSet& mask);
+
+        template <typename... Ts> const std::vector<Entity*>& query() { return query(componentMask<Ts...>()); }
+
+        void clear();
     };
+
+    template <typename T> T& CommandBuffer::instantiate() {
+        EntityPtr owner = manager.prepare<T>();
+        auto* e = static_cast<T*>(owner.get());
+        e->id = reserve();
+        e->onInstantiate();
+        spawns.emplace_back(std::move(owner));
+        return *e;
+    }
 }
 
 #endif //VAPE_ENTITYMANAGER_HPP
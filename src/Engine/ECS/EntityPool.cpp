@@ -0,0 +1,52 @@
+//
+// Created on 10/17/2026.
+//
+
+#include "EntityPool.hpp"
+
+namespace ECS {
+    namespace {
+        // Keeps every slot aligned for any entity type
+        std::size_t alignedSize(std::size_t size) {
+            const std::size_t alignment = alignof(std::max_align_t);
+            return (size + alignment - 1) / alignment * alignment;
+        }
+    }
+
+    SlabPool::SlabPool(std::string name, std::size_t size, std::size_t slotsPerSlab)
+        : name(std::move(name)), slotSize(alignedSize(size)), slotsPerSlab(slotsPerSlab) {}
+
+    void* SlabPool::allocate() {
+        if (freeList.empty()) {
+            std::unique_ptr<unsigned char[]> slab(new unsigned char[slotSize * slotsPerSlab]);
+            // Pushed in reverse so slots are handed out in address order
+            for (std::size_t i = slotsPerSlab; i > 0; --i)
+                freeList.push_back(slab.get() + (i - 1) * slotSize);
+            slabs.emplace_back(std::move(slab));
+        }
+        void* slot = freeList.back();
+        freeList.pop_back();
+        live++;
+        if (live > highWater)
+            highWater = live;
+        return slot;
+    }
+
+    void SlabPool::deallocate(void* slot) {
+        freeList.push_back(slot);
+        live--;
+    }
+
+    SlabPoolStats SlabPool::getStats() const {
+        return { name, slotSize, slabs.size() * slotsPerSlab, live, highWater };
+    }
+
+    std::vector<SlabPoolStats> EntityPools::getStats() const {
+        std::vector<SlabPoolStats> stats;
+        for (auto& pool : pools) {
+            if (pool)
+                stats.push_back(pool->getStats());
+        }
+        return stats;
+    }
+}
@@ -0,0 +1,112 @@
+//
+// Created on 10/17/2026.
+//
+// Per entity type slab allocation. Each type gets fixed size slots carved out of larger slabs,
+// recycled through a free list, so spawning and destroying entities doesn't go through the global heap.
+//
+
+#ifndef VAPE_ENTITYPOOL_HPP
+#define VAPE_ENTITYPOOL_HPP
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <string>
+#include <typeinfo>
+#include <utility>
+#include <vector>
+#include "Entity.hpp"
+
+namespace ECS {
+    using EntityTypeId = std::size_t;
+
+    inline EntityTypeId getEntityTypeId() {
+        static EntityTypeId lastId = 0;
+        return lastId++;
+    }
+
+    // Returns a unique id for each type T of entity
+    template <typename T> inline EntityTypeId getEntityTypeId() noexcept {
+        static EntityTypeId typeId = getEntityTypeId();
+        return typeId;
+    }
+
+    struct SlabPoolStats {
+        std::string name;
+        std::size_t slotSize;
+        std::size_t capacity; // Slots across all slabs
+        std::size_t live;
+        std::size_t highWater; // Most slots ever live at once
+    };
+
+    class SlabPool {
+    private:
+        std::string name;
+        std::size_t slotSize;
+        std::size_t slotsPerSlab;
+        std::vector<std::unique_ptr<unsigned char[]>> slabs;
+        std::vector<void*> freeList;
+        std::size_t live = 0;
+        std::size_t highWater = 0;
+
+    public:
+        SlabPool(std::string name, std::size_t size, std::size_t slotsPerSlab = 64);
+
+        void* allocate();
+        void deallocate(void* slot);
+
+        SlabPoolStats getStats() const;
+    };
+
+    // Destroys an entity and returns its memory to the pool it came from, or the heap if it has none
+    struct EntityDeleter {
+        SlabPool* pool;
+
+        EntityDeleter(SlabPool* pool = nullptr) : pool(pool) {}
+
+        void operator()(Entity* e) const {
+            if (pool == nullptr) {
+                delete e;
+                return;
+            }
+            e->~Entity();
+            pool->deallocate(e);
+        }
+    };
+
+    using EntityPtr = std::unique_ptr<Entity, EntityDeleter>;
+
+    class EntityPools {
+    private:
+        std::vector<std::unique_ptr<SlabPool>> pools; // Indexed by EntityTypeId
+
+    public:
+        template <typename T> SlabPool& get() {
+            static_assert(alignof(T) <= alignof(std::max_align_t), "Over-aligned entities are not supported");
+            auto id = getEntityTypeId<T>();
+            if (pools.size() <= id)
+                pools.resize(id + 1);
+            if (!pools[id])
+                pools[id].reset(new SlabPool(typeid(T).name(), sizeof(T)));
+            return *pools[id];
+        }
+
+        template <typename T, typename... TArgs> T* create(EntityPtr& owner, TArgs&&... mArgs) {
+            SlabPool& pool = get<T>();
+            void* slot = pool.allocate();
+            T* e;
+            try {
+                e = new (slot) T(std::forward<TArgs>(mArgs)...);
+            } catch (...) {
+                pool.deallocate(slot);
+                throw;
+            }
+            owner = EntityPtr(e, EntityDeleter(&pool));
+            return e;
+        }
+
+        std::vector<SlabPoolStats> getStats() const;
+    };
+}
+
+#endif //VAPE_ENTITYPOOL_HPP
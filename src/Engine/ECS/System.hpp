@@ -6,6 +6,8 @@
 #define VAPE_SYSTEM_HPP
 
 #include <cstddef>
+#include "Entity.hpp"
+#include "Archetype.hpp"
 
 namespace ECS {
     using SystemId = std::size_t;
@@ -27,9 +29,36 @@ namespace ECS {
     private:
         SystemId id;
         bool active = true;
+
+        // Components update reads and writes. Systems that don't declare their access are exclusive,
+        // they run alone on the main thread, in insertion order relative to every other system.
+        ComponentBitSet reads;
+        ComponentBitSet writes;
+        bool exclusive = true;
+    protected:
+        // Called from the system's constructor. Declaring access allows the system to run on a worker thread,
+        // in parallel with other systems it doesn't conflict with, so update must only touch the declared components.
+        // A system that touches none declares reading<>().
+        template <typename... Ts> void reading() {
+            reads |= componentMask<Ts...>();
+            exclusive = false;
+        }
+        template <typename... Ts> void writing() {
+            writes |= componentMask<Ts...>();
+            exclusive = false;
+        }
     public:
+        virtual ~System() = default;
+
         SystemId getId() const { return id; }
 
+        // Whether the two systems can't run at the same time
+        bool conflictsWith(const System& other) const {
+            if (exclusive || other.exclusive)
+                return true;
+            return (writes & (other.reads | other.writes)).any() || (other.writes & reads).any();
+        }
+
         virtual void update(float ms) {}
 
         bool isActive() { return active; };
@@ -7,10 +7,46 @@
 namespace ECS {
 
     void SystemManager::update(float ms) {
-        for (auto & s : systems) s->update(ms);
+        schedule();
+        for (auto & stage : stages) {
+            if (stage.size() == 1 || jobs == nullptr) {
+                for (auto* s : stage) s->update(ms);
+                continue;
+            }
+
+            Jobs::Counter counter;
+            for (std::size_t i = 1; i < stage.size(); ++i) {
+                System* s = stage[i];
+                jobs->run([s, ms]() { s->update(ms); }, &counter);
+            }
+            stage[0]->update(ms);
+            jobs->wait(counter);
+        }
         refresh();
     }
 
+    // Rebuilt every frame, since systems can be added or destroyed at any time
+    void SystemManager::schedule() {
+        for (auto & stage : stages) stage.clear();
+
+        std::vector<std::size_t> stageOf(systems.size());
+        for (std::size_t i = 0; i < systems.size(); ++i) {
+            std::size_t stage = 0;
+            for (std::size_t j = 0; j < i; ++j) {
+                if (systems[i]->conflictsWith(*systems[j]))
+                    stage = std::max(stage, stageOf[j] + 1);
+            }
+            stageOf[i] = stage;
+
+            if (stages.size() <= stage)
+                stages.resize(stage + 1);
+            stages[stage].push_back(systems[i].get());
+        }
+
+        while (!stages.empty() && stages.back().empty())
+            stages.pop_back();
+    }
+
     // https://en.cppreference.com/w/cpp/algorithm/remove
     void SystemManager::refresh() {
         // This erases from the entities vector based on which entities are not active
@@ -25,6 +61,7 @@ namespace ECS {
     }
 
     void SystemManager::clear() {
+        stages.clear();
         systems.clear();
         systemBitSet.reset();
     }
@@ -12,6 +12,7 @@
 #include <array>
 #include <vector>
 #include "System.hpp"
+#include <Engine/Jobs/JobSystem.hpp>
 
 namespace ECS {
     constexpr std::size_t maxSystems = 32;
@@ -28,7 +29,16 @@ namespace ECS {
         SystemArray systemArray; // Systems indexed by typeId
         SystemBitSet systemBitSet; // Quick True/False lookup for if has system;
 
+        // Systems grouped into stages, where a system is placed one stage after the last earlier system
+        // it conflicts with. Systems within a stage run in parallel.
+        std::vector<std::vector<System*>> stages;
+        Jobs::JobSystem* jobs = nullptr; // Stages run serially without one
+
+        void schedule();
+
     public:
+        void setJobSystem(Jobs::JobSystem* jobSystem) { jobs = jobSystem; }
+
         void update(float ms);
 
         void refresh();
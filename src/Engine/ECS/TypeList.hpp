@@ -0,0 +1,31 @@
+//
+// Created on 10/17/2026.
+//
+
+#ifndef VAPE_TYPELIST_HPP
+#define VAPE_TYPELIST_HPP
+
+#include <cstddef>
+#include <type_traits>
+
+namespace ECS {
+    template <typename... Ts> struct TypeList {
+        static constexpr std::size_t size = sizeof...(Ts);
+    };
+
+    // Position of T in a TypeList, a compile error if it isn't in the list
+    template <typename T, typename List> struct TypeIndex;
+
+    template <typename T, typename... Ts> struct TypeIndex<T, TypeList<T, Ts...>>
+            : std::integral_constant<std::size_t, 0> {};
+
+    template <typename T, typename U, typename... Ts> struct TypeIndex<T, TypeList<U, Ts...>>
+            : std::integral_constant<std::size_t, 1 + TypeIndex<T, TypeList<Ts...>>::value> {};
+
+    template <typename T> struct TypeIndex<T, TypeList<>> {
+        static_assert(!std::is_same<T, T>::value, "Type is not registered, add it to the type list");
+        static constexpr std::size_t value = 0;
+    };
+}
+
+#endif //VAPE_TYPELIST_HPP
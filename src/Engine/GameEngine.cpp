@@ -6,6 +6,7 @@
 
 #include "GameEngine.hpp"
 #include "GameState.hpp"
+#include <Components/MotionComponent.hpp>
 
 // internal
 #include "common.hpp"
@@ -15,6 +16,7 @@
 
 // stlib
 #include <chrono>
+#include <cmath>
 #include <iostream>
 
 // Same as static in c, local to compilation unit
@@ -92,6 +94,9 @@ void GameEngine::init() {
         throw std::runtime_error("Failed to open audio device");
     }
 
+    jobSystem.init();
+    systemManager.setJobSystem(&jobSystem);
+
     m_current_speed = 1.f;
 
     running = true;
@@ -109,6 +114,9 @@ void GameEngine::terminate() {
     delete(state);
     state = nullptr;
 
+    systemManager.setJobSystem(nullptr);
+    jobSystem.terminate();
+
     //Free the music
     Mix_FreeMusic(music);
     music = nullptr;
@@ -134,29 +142,61 @@ void GameEngine::changeState(GameState *state) {
     }
     entityManager.clear();
     systemManager.clear();
+    m_accumulator_ms = 0.f; // The new state starts from a clean step, loading it isn't caught up on
     this->state = state;
     state->init();
     changingState = false;
 }
 
 /*!
- * Runs the state's update function
+ * Advances the simulation in fixed steps by the elapsed time, scaled by the current speed.
+ * Time left over carries to the next update, and is used to interpolate what gets drawn.
  */
 void GameEngine::update(float ms) {
-    entityManager.update(ms * m_current_speed);
-    systemManager.update(ms * m_current_speed);
     this->elapsed_ms = ms;
-    state->update(ms * m_current_speed);
+    m_accumulator_ms += ms * m_current_speed;
+
+    int steps = 0;
+    while (m_accumulator_ms >= m_step_ms && steps < m_max_steps) {
+        m_accumulator_ms -= m_step_ms; // Before stepping, a state change during the step resets it
+        step(m_step_ms);
+        steps++;
+    }
+
+    // Too far behind (e.g. a long load or a breakpoint), the simulation slows down rather than spiralling
+    if (m_accumulator_ms >= m_step_ms)
+        m_accumulator_ms = std::fmod(m_accumulator_ms, m_step_ms);
+
+    // Paused, states still need to update to handle input
+    if (m_current_speed == 0.f)
+        step(0.f);
+
+    m_interpolation = m_accumulator_ms / m_step_ms;
 
     if (glfwWindowShouldClose(m_window)) {
         this->running = false;
     }
 }
 
+/*!
+ * Runs one simulation step of the entities, systems and state
+ */
+void GameEngine::step(float ms) {
+    for (auto* e : entityManager.query<MotionComponent>())
+        e->getComponent<MotionComponent>()->beginStep();
+
+    entityManager.update(ms);
+    systemManager.update(ms);
+    state->update(ms);
+}
+
 /*!
  * Runs the state's render function
  */
 void GameEngine::draw() {
+    for (auto* e : entityManager.query<MotionComponent>())
+        e->getComponent<MotionComponent>()->interpolate(m_interpolation);
+
     //entityManager.draw(...);
     //systemManager.draw(...);
     state->draw();
@@ -218,6 +258,22 @@ void GameEngine::setM_current_speed(float m_current_speed) {
     GameEngine::m_current_speed = m_current_speed;
 }
 
+float GameEngine::getSimulationRate() const {
+    return 1000.f / m_step_ms;
+}
+
+void GameEngine::setSimulationRate(float hz) {
+    m_step_ms = 1000.f / hz;
+}
+
+void GameEngine::setMaxSimulationSteps(int steps) {
+    m_max_steps = steps;
+}
+
+float GameEngine::getInterpolation() const {
+    return m_interpolation;
+}
+
 void GameEngine::toggleM_debug_mode() {
     GameEngine::m_debug_mode = !GameEngine::m_debug_mode;
 }
@@ -234,3 +290,6 @@ ECS::EntityManager *GameEngine::getEntityManager() {
 ECS::SystemManager *GameEngine::getSystemManager() {
     return &systemManager;
 }
+Jobs::JobSystem *GameEngine::getJobSystem() {
+    return &jobSystem;
+}
@@ -19,6 +19,7 @@
 #include <map>
 #include "Engine/ECS/ECS.hpp"
 #include "ECS/ECS.hpp"
+#include "Jobs/JobSystem.hpp"
 
 class GameState;
 
@@ -45,10 +46,10 @@ public:
      */
     void changeState(GameState *state);
 
-    //! Updates the state
+    //! Advances the simulation by the elapsed time, in fixed steps
     void update(float ms);
 
-    //! Renders the state
+    //! Renders the state, interpolating positions between the last two simulation steps
     void draw();
 
     //! Returns whether the engine is currently running
@@ -72,12 +73,24 @@ public:
 
     void setM_current_speed(float m_current_speed);
 
+    //! Simulation steps per second of (speed scaled) game time, independent of the display rate
+    float getSimulationRate() const;
+
+    void setSimulationRate(float hz);
+
+    //! Most simulation steps a single update will run to catch up, further time is dropped
+    void setMaxSimulationSteps(int steps);
+
+    //! How far between the last simulation step and the next one the current frame is, from 0 to 1
+    float getInterpolation() const;
+
     void toggleM_debug_mode();
 
     bool getM_debug_mode();
 
     ECS::EntityManager *getEntityManager();
     ECS::SystemManager *getSystemManager();
+    Jobs::JobSystem *getJobSystem();
 
 private:
     GameEngine() = default; // private constructor
@@ -91,12 +104,24 @@ private:
     //! The current loaded audio track
     Mix_Music * music{};
 
+    //! Shared worker threads, started in init and joined in terminate
+    Jobs::JobSystem jobSystem;
+
     ECS::EntityManager entityManager;
     ECS::SystemManager systemManager;
 
     float m_current_speed = 1.f;
     bool m_debug_mode = false;
 
+    //! Fixed timestep simulation, see update
+    float m_step_ms = 1000.f / 120.f;
+    int m_max_steps = 8;
+    float m_accumulator_ms = 0.f;
+    float m_interpolation = 0.f;
+
+    //! Runs one simulation step of ms
+    void step(float ms);
+
     float elapsed_ms{};
 
     bool running{};
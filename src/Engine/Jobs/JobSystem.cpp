@@ -0,0 +1,184 @@
+//
+// Created on 10/17/2026.
+//
+
+#include "JobSystem.hpp"
+
+namespace Jobs {
+    namespace {
+        // Queue owned by the current thread, 0 for the main thread and threads outside the job system
+        thread_local std::size_t currentQueue = 0;
+        thread_local const JobSystem* currentSystem = nullptr;
+    }
+
+    void JobSystem::init(unsigned threads) {
+        terminate();
+        stopping = false;
+        for (unsigned i = 0; i <= threads; ++i)
+            queues.emplace_back(new Queue());
+        currentSystem = this;
+        currentQueue = 0;
+        for (unsigned i = 1; i <= threads; ++i)
+            workers.emplace_back(&JobSystem::work, this, i);
+    }
+
+    void JobSystem::terminate() {
+        if (queues.empty())
+            return;
+        while (tryRun(queueIndex())) {}
+
+        stopping = true;
+        {
+            std::lock_guard<std::mutex> lock(sleepMutex);
+        }
+        sleep.notify_all();
+        for (auto& worker : workers)
+            worker.join();
+        workers.clear();
+        queues.clear();
+    }
+
+    std::size_t JobSystem::queueIndex() const {
+        return currentSystem == this ? currentQueue : 0;
+    }
+
+    void JobSystem::work(std::size_t index) {
+        currentSystem = this;
+        currentQueue = index;
+        while (true) {
+            if (tryRun(index))
+                continue;
+            if (stopping)
+                return;
+            std::unique_lock<std::mutex> lock(sleepMutex);
+            sleep.wait(lock, [this] { return stopping || queued > 0; });
+        }
+    }
+
+    void JobSystem::push(Job job) {
+        Queue& queue = *queues[queueIndex()];
+        {
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            queue.jobs.push_back(std::move(job));
+        }
+        queued++;
+        {
+            std::lock_guard<std::mutex> lock(sleepMutex);
+        }
+        sleep.notify_one();
+    }
+
+    bool JobSystem::pop(std::size_t index, Job& job) {
+        Queue& queue = *queues[index];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (queue.jobs.empty())
+            return false;
+        job = std::move(queue.jobs.back());
+        queue.jobs.pop_back();
+        return true;
+    }
+
+    bool JobSystem::steal(std::size_t index, Job& job) {
+        for (std::size_t i = 1; i < queues.size(); ++i) {
+            Queue& victim = *queues[(index + i) % queues.size()];
+            std::lock_guard<std::mutex> lock(victim.mutex);
+            if (!victim.jobs.empty()) {
+                job = std::move(victim.jobs.front());
+                victim.jobs.pop_front();
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool JobSystem::tryRun(std::size_t index) {
+        Job job;
+        if (!pop(index, job) && !steal(index, job))
+            return false;
+        queued--;
+        job();
+        return true;
+    }
+
+    // Runs the job and always finishes its counter, so an exception can't leave a waiter spinning.
+    // The exception is kept for wait, a job without a counter has nowhere to report it.
+    void JobSystem::execute(const Job& job, Counter* counter) {
+        try {
+            job();
+        } catch (...) {
+            if (counter == nullptr)
+                std::terminate();
+            std::lock_guard<std::mutex> lock(counter->mutex);
+            if (!counter->error)
+                counter->error = std::current_exception();
+        }
+        finish(counter);
+    }
+
+    // Decremented under the counter's lock, so a waiter that sees zero (and then takes the lock)
+    // knows the counter is no longer touched and can be destroyed
+    void JobSystem::finish(Counter* counter) {
+        if (counter == nullptr)
+            return;
+
+        std::vector<Job> continuations;
+        {
+            std::lock_guard<std::mutex> lock(counter->mutex);
+            if (--counter->pending > 0)
+                return;
+            continuations.swap(counter->continuations);
+        }
+        for (auto& job : continuations)
+            run(std::move(job));
+    }
+
+    void JobSystem::run(Job job, Counter* counter) {
+        if (counter != nullptr)
+            counter->pending++;
+
+        if (workers.empty()) {
+            // Nothing to finish, so the exception can go straight to the caller
+            if (counter == nullptr)
+                job();
+            else
+                execute(job, counter);
+            return;
+        }
+
+        push([this, job, counter]() {
+            execute(job, counter);
+        });
+    }
+
+    void JobSystem::runAfter(Counter& dependency, Job job, Counter* counter) {
+        if (counter != nullptr)
+            counter->pending++;
+
+        // Decrements the counter once done, like a job passed to run
+        Job wrapped = [this, job, counter]() {
+            execute(job, counter);
+        };
+        {
+            std::lock_guard<std::mutex> lock(dependency.mutex);
+            if (!dependency.done()) {
+                dependency.continuations.push_back(std::move(wrapped));
+                return;
+            }
+        }
+        run(std::move(wrapped));
+    }
+
+    void JobSystem::wait(Counter& counter) {
+        while (!counter.done()) {
+            if (queues.empty() || !tryRun(queueIndex()))
+                std::this_thread::yield();
+        }
+        std::exception_ptr error;
+        {
+            std::lock_guard<std::mutex> lock(counter.mutex);
+            std::swap(error, counter.error);
+        }
+        if (error)
+            std::rethrow_exception(error);
+    }
+}
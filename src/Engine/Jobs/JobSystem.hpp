@@ -0,0 +1,115 @@
+//
+// Created on 10/17/2026.
+//
+// Work stealing job scheduler. Each worker owns a deque, popping its own jobs from the back
+// and stealing from the front of the others' when it runs dry. Threads waiting on a Counter
+// run jobs instead of blocking, so fork/join from inside a job doesn't deadlock.
+//
+
+#ifndef VAPE_JOBSYSTEM_HPP
+#define VAPE_JOBSYSTEM_HPP
+
+#include <atomic>
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Jobs {
+    using Job = std::function<void()>;
+
+    class JobSystem;
+
+    // Number of jobs still outstanding, wait on it to join. Jobs added with runAfter start once it reaches zero.
+    // The first exception thrown by one of its jobs is rethrown by wait.
+    class Counter {
+        friend class JobSystem;
+    private:
+        std::atomic<int> pending{ 0 };
+        std::mutex mutex;
+        std::vector<Job> continuations;
+        std::exception_ptr error;
+    public:
+        bool done() const { return pending.load() == 0; }
+    };
+
+    class JobSystem {
+    private:
+        struct Queue {
+            std::mutex mutex;
+            std::deque<Job> jobs;
+        };
+
+        std::vector<std::unique_ptr<Queue>> queues; // 0 belongs to the thread that called init, 1.. to the workers
+        std::vector<std::thread> workers;
+        std::atomic<int> queued{ 0 };
+        std::atomic<bool> stopping{ false };
+        std::mutex sleepMutex;
+        std::condition_variable sleep;
+
+        void work(std::size_t index);
+        void push(Job job);
+        bool tryRun(std::size_t index);
+        bool pop(std::size_t index, Job& job);
+        bool steal(std::size_t index, Job& job);
+        void execute(const Job& job, Counter* counter);
+        void finish(Counter* counter);
+        std::size_t queueIndex() const;
+
+    public:
+        JobSystem() = default;
+        JobSystem(const JobSystem&) = delete;
+        JobSystem& operator=(const JobSystem&) = delete;
+        ~JobSystem() { terminate(); }
+
+        // Starts the workers, by default one less than the hardware threads since the calling thread also runs jobs
+        void init(unsigned threads = std::thread::hardware_concurrency() > 1 ? std::thread::hardware_concurrency() - 1 : 0);
+
+        // Runs whatever is still queued, then joins the workers
+        void terminate();
+
+        // Threads that can run jobs, including the calling one
+        std::size_t getThreadCount() const { return workers.size() + 1; }
+
+        // Queues a job, counter (if any) is incremented now and decremented once the job is done, even if it throws.
+        // Without workers the job runs immediately. A queued job without a counter that throws terminates.
+        void run(Job job, Counter* counter = nullptr);
+
+        // Queues job once dependency reaches zero
+        void runAfter(Counter& dependency, Job job, Counter* counter = nullptr);
+
+        // Runs queued jobs until the counter reaches zero, then rethrows the first exception of its jobs
+        void wait(Counter& counter);
+
+        // Calls fn(i) for every i in [begin, end), split into jobs of grain indices.
+        // A grain of 0 picks one giving each thread a few jobs to balance uneven work.
+        template <typename Fn> void parallel_for(std::size_t begin, std::size_t end, Fn fn, std::size_t grain = 0) {
+            if (end <= begin)
+                return;
+            std::size_t count = end - begin;
+            if (grain == 0)
+                grain = std::max<std::size_t>(1, count / (getThreadCount() * 4));
+            if (workers.empty() || count <= grain) {
+                for (std::size_t i = begin; i < end; ++i) fn(i);
+                return;
+            }
+
+            Counter counter;
+            for (std::size_t start = begin; start < end; start += grain) {
+                std::size_t stop = std::min(end, start + grain);
+                run([&fn, start, stop]() {
+                    for (std::size_t i = start; i < stop; ++i) fn(i);
+                }, &counter);
+            }
+            wait(counter);
+        }
+    };
+}
+
+#endif //VAPE_JOBSYSTEM_HPP
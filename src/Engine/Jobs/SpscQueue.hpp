@@ -0,0 +1,66 @@
+//
+// Created on 10/17/2026.
+//
+// Bounded lock-free queue between exactly one producer thread and one consumer thread.
+// The producer only writes tail and the consumer only writes head, so a release store of one
+// paired with an acquire load on the other side is enough to hand over the slot.
+//
+
+#ifndef VAPE_SPSCQUEUE_HPP
+#define VAPE_SPSCQUEUE_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace Jobs {
+    template <typename T> class SpscQueue {
+    private:
+        std::vector<T> slots;
+        std::size_t mask;
+        // Padding keeps head and tail on separate cache lines, they're written by different threads
+        char padBefore[64];
+        std::atomic<std::size_t> head{ 0 }; // Next slot to pop
+        char padBetween[64];
+        std::atomic<std::size_t> tail{ 0 }; // Next slot to push
+        char padAfter[64];
+
+        static std::size_t roundUp(std::size_t capacity) {
+            std::size_t size = 1;
+            while (size < capacity) size <<= 1u;
+            return size;
+        }
+    public:
+        // Capacity is rounded up to a power of two
+        explicit SpscQueue(std::size_t capacity) : slots(roundUp(capacity)), mask(roundUp(capacity) - 1) {}
+        SpscQueue(const SpscQueue&) = delete;
+        SpscQueue& operator=(const SpscQueue&) = delete;
+
+        // Producer only, false if the queue is full
+        bool push(T&& value) {
+            std::size_t t = tail.load(std::memory_order_relaxed);
+            if (t - head.load(std::memory_order_acquire) == slots.size())
+                return false;
+            slots[t & mask] = std::move(value);
+            tail.store(t + 1, std::memory_order_release);
+            return true;
+        }
+
+        // Consumer only, false if the queue is empty
+        bool pop(T& value) {
+            std::size_t h = head.load(std::memory_order_relaxed);
+            if (h == tail.load(std::memory_order_acquire))
+                return false;
+            value = std::move(slots[h & mask]);
+            head.store(h + 1, std::memory_order_release);
+            return true;
+        }
+
+        bool empty() const {
+            return head.load(std::memory_order_acquire) == tail.load(std::memory_order_acquire);
+        }
+    };
+}
+
+#endif //VAPE_SPSCQUEUE_HPP
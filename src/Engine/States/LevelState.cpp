@@ -16,6 +16,7 @@
 #include <Entities/Bosses/Boss2.hpp>
 #include <Systems/ProjectileSystem.hpp>
 #include <Systems/PickupSystem.hpp>
+#include <Systems/CullingSystem.hpp>
 
 #include "LevelState.hpp"
 #include "MainMenuState.hpp"
@@ -39,7 +40,7 @@ namespace
     const size_t VAMP_ACTIVATION_COST = 0;
     const float VAMP_TIME_SLOWDOWN = 0.5f;
     const float BOSS_EXPLOSION_COOLDOWN = 400;
-    const float PATH_UPDATE_COOLDOWN = 100;
+    const float PATH_UPDATE_COOLDOWN = 25;
 }
 
 
@@ -114,6 +115,7 @@ void LevelState::init() {
     m_path_update_cooldown = 0;
 
     aiGrid.init(screen.x, screen.y, 32);
+    m_pathfinding.start();
     m_dot.init();
 
     m_pause = &GameEngine::getInstance().getEntityManager()->addEntity<PauseMenu>();
@@ -151,10 +153,12 @@ void LevelState::init() {
     // m_font_ranger = Font(font_path("spaceranger.ttf"));
 
     GameEngine::getInstance().getSystemManager()->addSystem<MotionSystem>();
+    GameEngine::getInstance().getSystemManager()->addSystem<CullingSystem>();
     auto & spawn = GameEngine::getInstance().getSystemManager()->addSystem<EnemySpawnerSystem>();
-    spawn.reset(m_level.timeline);
+    spawn.reset(*m_level.timeline);
     GameEngine::getInstance().getSystemManager()->addSystem<ProjectileSystem>();
 	GameEngine::getInstance().getSystemManager()->addSystem<PickupSystem>();
+    GameEngine::getInstance().getSystemManager()->addSystem<CollisionSystem>();
 
     GameEngine::getInstance().setM_current_speed(1.f);
 
@@ -171,7 +175,7 @@ void LevelState::init() {
 void LevelState::terminate() {
     Mix_HaltChannel(-1);
     auto & spawn = GameEngine::getInstance().getSystemManager()->getSystem<EnemySpawnerSystem>();
-    spawn.reset(m_level.timeline);
+    spawn.reset(*m_level.timeline);
 
 	auto& pickup_sys = GameEngine::getInstance().getSystemManager()->getSystem<PickupSystem>();
 	pickup_sys.clear();
@@ -200,6 +204,7 @@ void LevelState::terminate() {
         Mix_FreeChunk(m_player_explosion);
     m_player_explosion_file.destroy();
 
+    m_pathfinding.stop();
     aiGrid.destroy();
 
     m_pause->destroy();
@@ -281,114 +286,98 @@ void LevelState::update(float ms) {
         enemy->player_position = m_player->get_position();
     }
 
-    // Checking Player - Enemy collisions
-    auto enemy_it = enemies->begin();
-    while (enemy_it != enemies->end())
-    {
-        if (m_player->collides_with(**enemy_it))
-        {
-            if (m_player->is_alive()) {
-                if (m_player->get_iframes() <= 0.f) {
-                    m_player->set_iframes(500.f);
-                    lose_health(DAMAGE_COLLIDE);
-                    Mix_PlayChannel(-1, m_player_explosion, 0);
-                    (*enemy_it)->destroy();
-                    enemy_it = enemies->erase(enemy_it);
-                }
-            }
-            break;
-        } else
-        {
-            enemy_it++;
-        }
-    }
+    auto* entityManager = GameEngine::getInstance().getEntityManager();
+    auto& collisions = GameEngine::getInstance().getSystemManager()->getSystem<CollisionSystem>().getEvents();
 
-    // Checking Enemy Bullet - Player collisions
-    auto& bullets = projectiles.hostile_projectiles;
+    // Checking Player - Enemy collisions
+    for (auto& collision : collisions.get(CollisionClass::Player, CollisionClass::Enemy)) {
+        auto* enemy = entityManager->getEntity<Enemy>(collision.b);
+        if (enemy == nullptr || !enemy->isActive())
+            continue;
 
-    // Checking Enemy Bullet - Player collisions
-    auto bullet_it = bullets.begin();
-    while (bullet_it != bullets.end()) {
-        if ((*bullet_it)->collides_with(*m_player))
-        {
-            (*bullet_it)->destroy();
-            if (m_player->is_alive() && m_player->get_iframes() <= 0.f) {
+        if (m_player->is_alive()) {
+            if (m_player->get_iframes() <= 0.f) {
                 m_player->set_iframes(500.f);
-                lose_health((*bullet_it)->getDamage());
+                lose_health(DAMAGE_COLLIDE);
+                Mix_PlayChannel(-1, m_player_explosion, 0);
+                enemy->destroy();
             }
-
-            bullet_it = bullets.erase(bullet_it);
-            break;
-        } else {
-            ++bullet_it;
         }
+        break;
     }
 
-    // Check Pickup Collisions
-    auto pickup_it = pickups->begin();
-    while (pickup_it != pickups->end()) {
-        if ((*pickup_it)->collides_with(*m_player)) {
-            (*pickup_it)->applyEffect(*m_player);
-            (*pickup_it)->destroy();
-            pickup_it = pickups->erase(pickup_it);
-			break;
+    // Checking Enemy Bullet - Player collisions, boss bullets are checked with the boss
+    auto& bullets = projectiles.getHostileProjectiles();
+    for (auto& collision : collisions.get(CollisionClass::Player, CollisionClass::HostileProjectile)) {
+        auto* bullet = entityManager->getEntity<Projectile>(collision.b);
+        auto bullet_it = std::find(bullets.begin(), bullets.end(), bullet);
+        if (bullet == nullptr || !bullet->isActive() || bullet_it == bullets.end())
+            continue;
+
+        bullet->destroy();
+        if (m_player->is_alive() && m_player->get_iframes() <= 0.f) {
+            m_player->set_iframes(500.f);
+            lose_health(bullet->getDamage());
         }
-		pickup_it++;
+        break;
     }
 
-    // Checking Player Bullet - Enemy collisions
-    auto& playerBullets = projectiles.friendly_projectiles;
-    bullet_it = playerBullets.begin();
-    while (bullet_it != playerBullets.end())
-    {
-        bool eraseBullet = false;
-        auto enemy_it = enemies->begin();
-        while (enemy_it != enemies->end())
-        {
-            if ((*bullet_it)->collides_with(**enemy_it))
-            {
-                eraseBullet = true;
+    // Check Pickup Collisions
+    for (auto& collision : collisions.get(CollisionClass::Player, CollisionClass::Pickup)) {
+        auto* pickup = entityManager->getEntity<Pickup>(collision.b);
+        auto pickup_it = std::find(pickups->begin(), pickups->end(), pickup);
+        if (pickup == nullptr || !pickup->isActive() || pickup_it == pickups->end())
+            continue;
 
-                spawn_score_text((*enemy_it)->get_points(), (*enemy_it)->get_position());
+        pickup->applyEffect(*m_player);
+        pickup->destroy();
+        pickups->erase(pickup_it);
+        break;
+    }
 
-                m_explosion.spawn((*enemy_it)->get_position());
-                m_points += (*enemy_it)->get_points();
-                (*enemy_it)->destroy();
-                enemy_it = enemies->erase(enemy_it);
-                Mix_PlayChannel(-1,m_player_explosion,0);
-                add_vamp_charge();
+    // Checking Player Bullet - Enemy collisions, a bullet is spent on the first thing it hits
+    for (auto& collision : collisions.get(CollisionClass::FriendlyProjectile, CollisionClass::Enemy)) {
+        auto* bullet = entityManager->getEntity<Projectile>(collision.a);
+        auto* enemy = entityManager->getEntity<Enemy>(collision.b);
+        if (bullet == nullptr || enemy == nullptr || !bullet->isActive() || !enemy->isActive())
+            continue;
 
-                break;
-            } else {
-                ++enemy_it;
-            }
+        spawn_score_text(enemy->get_points(), enemy->get_position());
+
+        m_explosion.spawn(enemy->get_position());
+        m_points += enemy->get_points();
+        enemy->destroy();
+        Mix_PlayChannel(-1,m_player_explosion,0);
+        add_vamp_charge();
+        bullet->destroy();
+    }
+    if (m_boss_mode && m_boss->is_alive()) {
+        for (auto& collision : collisions.get(CollisionClass::FriendlyProjectile, CollisionClass::Boss)) {
+            auto* bullet = entityManager->getEntity<Projectile>(collision.a);
+            if (bullet == nullptr || !bullet->isActive())
+                continue;
+
+            // TODO sound
+            add_vamp_charge();
+            m_boss->addDamage(2);
+            bullet->destroy();
         }
-        if (m_boss_mode && m_boss->is_alive()) {
-			if ((*bullet_it)->collides_with(*m_boss)) {
-				eraseBullet = true;
-				// TODO sound
-				add_vamp_charge();
-				m_boss->addDamage(2);
-			} 
-			if (m_boss->hasClones()) {
-				auto& clones = m_boss->clones;
-				auto clone_it = clones.begin();
-				while (clone_it != clones.end()) {
-					if ((*bullet_it)->collides_with(**clone_it)) {
-						(*clone_it)->stun();
-						eraseBullet = true;
-					} 
-					clone_it++;
-				}
-			}
+        for (auto& collision : collisions.get(CollisionClass::FriendlyProjectile, CollisionClass::Clone)) {
+            auto* bullet = entityManager->getEntity<Projectile>(collision.a);
+            auto* clone = entityManager->getEntity<Clone>(collision.b);
+            if (bullet == nullptr || clone == nullptr || !bullet->isActive())
+                continue;
+
+            clone->stun();
+            bullet->destroy();
         }
-        if (eraseBullet) {
-            (*bullet_it)->destroy();
-            bullet_it = playerBullets.erase(bullet_it);
-        } else
-            ++bullet_it;
     }
 
+    // Remove everything destroyed by the collisions above
+    auto destroyed = [](const ECS::Entity* e) { return !e->isActive(); };
+    enemies->erase(std::remove_if(enemies->begin(), enemies->end(), destroyed), enemies->end());
+    projectiles.removeDestroyed();
+
     // add health if enough vampParticles
     m_numVampParticles += m_vamp_particle_emitter.getCapturedParticles();
     // 6 is average of particles dropped per kill
@@ -401,7 +390,7 @@ void LevelState::update(float ms) {
     m_vamp_cooldown -= ms;
 
     if (m_vamp_mode) {
-        enemy_it = enemies->begin();
+        auto enemy_it = enemies->begin();
         while (enemy_it != enemies->end()) {
             if (m_vamp.collides_with(**enemy_it)) {
                 // TODO - Re-add resetting vamp timer on leaving aura
@@ -444,31 +433,22 @@ void LevelState::update(float ms) {
 
 
     m_player->update(ms, keyMap, mouse_position);
+
+    // Paths solved since the last update, skipping enemies destroyed in the meantime
+    PathResult path;
+    while (m_pathfinding.poll(path)) {
+        auto* enemy = GameEngine::getInstance().getEntityManager()->getEntity<Enemy>(path.entity);
+        if (enemy != nullptr && enemy->isActive()) enemy->set_path(path.path);
+    }
 	for (auto& enemy : *enemies){
-        if (m_path_update_cooldown <= 0) enemy->set_path(aiGrid.getPath(*enemy, *m_player));
+        if (m_path_update_cooldown <= 0)
+            m_pathfinding.request(enemy->getId(), enemy->get_position(), enemy->get_bounding_box(), m_player->get_position());
         enemy->update(ms);
 	}
 
 	/*for (auto& pkup : *pickups)
 		pkup->update(ms);*/
 
-    // Removing out of screen enemies
-    enemy_it = enemies->begin();
-    while (enemy_it != enemies->end())
-    {
-        float h = (*enemy_it)->get_bounding_box().y / 2;
-        float w = (*enemy_it)->get_bounding_box().x / 2;
-        if (std::abs((*enemy_it)->get_position().y) + h > screen.y + 400
-            || std::abs((*enemy_it)->get_position().x) + w > screen.x + 400) {
-            (*enemy_it)->destroy();
-            enemy_it = enemies->erase(enemy_it);
-            continue;
-        } else {
-            ++enemy_it;
-        }
-    }
-
-
     // debug state
     if (m_debug_mode)
     {
@@ -614,7 +594,7 @@ void LevelState::update(float ms) {
                 }
             }
 
-            // Removing out of screen bullets
+            // Removing out of screen bullets, the boss owns these so CullingSystem leaves them alone
             boss_bullet_it = bossBullets.begin();
             while(boss_bullet_it != bossBullets.end()) {
                 if ((*boss_bullet_it)->isOffScreen(screen))
@@ -674,15 +654,15 @@ void LevelState::update(float ms) {
         }
     }
 
-    aiGrid.clear();
+    aiGrid.beginUpdate();
     for (auto enemy : *enemies)
         aiGrid.addToGrid(*enemy);
-    for (auto projectile : projectiles.hostile_projectiles)
+    for (auto projectile : projectiles.getHostileProjectiles())
         aiGrid.addToGrid(*projectile);
     if (m_vamp_mode)
         aiGrid.addToGrid(m_vamp);
     aiGrid.addToGrid(*m_player);
-    for (auto projectile : projectiles.friendly_projectiles)
+    for (auto projectile : projectiles.getFriendlyProjectiles())
         aiGrid.addToGrid(*projectile);
     for (auto pickup : *pickups)
         aiGrid.addToGrid(*pickup);
@@ -690,6 +670,9 @@ void LevelState::update(float ms) {
         aiGrid.addToGrid(*m_boss);
         // TODO boss clones?
     }
+    aiGrid.endUpdate();
+    // Requests are solved off the main thread against this frame's grid
+    m_pathfinding.publish(aiGrid);
 
     if (m_path_update_cooldown <= 0) {
         m_path_update_cooldown = PATH_UPDATE_COOLDOWN;
@@ -747,13 +730,13 @@ void LevelState::draw() {
     }
 
     // Drawing entities
-    for (auto* projectile : projectiles.hostile_projectiles)
+    for (auto* projectile : projectiles.getHostileProjectiles())
         projectile->draw(projection_2D);
 	for (auto& enemy : (*enemies))
 		enemy->draw(projection_2D);
 	for (auto& pickup : (*pickups))
 		pickup->draw(projection_2D);
-    for (auto* projectile : projectiles.friendly_projectiles)
+    for (auto* projectile : projectiles.getFriendlyProjectiles())
         projectile->draw(projection_2D);
     m_player->draw(projection_2D);
     if (m_boss_pre) {
@@ -39,6 +39,7 @@
 #include <Entities/UI/PauseMenu/PauseMenu.hpp>
 #include <Utils/PhysFSHelpers.hpp>
 #include <Entities/EntityGrid.hpp>
+#include <Entities/PathfindingService.hpp>
 #include <Entities/Debugging/DebugDot.hpp>
 #include <Entities/UI/ScoreText.hpp>
 #include <Entities/UI/PlayerScore/Score.hpp>
@@ -79,6 +80,7 @@ private:
     Levels::Level m_level;
 
     EntityGrid aiGrid;
+    PathfindingService m_pathfinding;
 
     PauseMenu* m_pause;
 
@@ -10,6 +10,7 @@
 #include <sstream>
 #include <algorithm>
 #include <Systems/EnemySpawnerSystem.hpp>
+#include <Systems/CullingSystem.hpp>
 #include <Systems/MotionSystem.hpp>
 #include <Systems/ProjectileSystem.hpp>
 
@@ -121,6 +122,7 @@ void TutorialState::init() {
 	m_vamp_mode_charge = 0;
 
 	GameEngine::getInstance().getSystemManager()->addSystem<MotionSystem>();
+	GameEngine::getInstance().getSystemManager()->addSystem<CullingSystem>();
 	GameEngine::getInstance().getSystemManager()->addSystem<ProjectileSystem>();
 
     m_space.set_position({screen.x/2, 0});
@@ -250,19 +252,15 @@ void TutorialState::update(float ms) {
 		}
 	}
 
-	auto& playerBullets = projectiles.friendly_projectiles;
-
 	// Checking Player Bullet - Enemy collisions
-	auto bullet_it = playerBullets.begin();
-	while (bullet_it != playerBullets.end())
+	for (auto* bullet : projectiles.getFriendlyProjectiles())
 	{
-		bool eraseBullet = false;
 		auto turtle_it = m_turtles.begin();
 		while (turtle_it != m_turtles.end())
 		{
-			if ((*bullet_it)->collides_with(**turtle_it))
+			if (bullet->collides_with(**turtle_it))
 			{
-				eraseBullet = true;
+				bullet->destroy();
 				spawn_score_text((*turtle_it)->get_points(), (*turtle_it)->get_position());
                 m_explosion.spawn((*turtle_it)->get_position());
 				m_points += (*turtle_it)->get_points();
@@ -281,12 +279,8 @@ void TutorialState::update(float ms) {
 				++turtle_it;
 			}
 		}
-		if (eraseBullet) {
-            (*bullet_it)->destroy();
-            bullet_it = playerBullets.erase(bullet_it);
-        }else
-			++bullet_it;
 	}
+	projectiles.removeDestroyed();
 
 	// add health if enough vampParticles
 	m_numVampParticles += m_vamp_particle_emitter.getCapturedParticles();
@@ -464,7 +458,7 @@ void TutorialState::draw() {
 		m_vamp.draw(projection_2D);
 	}
 	m_vamp_particle_emitter.draw(projection_2D);
-	for (auto* projectile: projectiles.friendly_projectiles)
+	for (auto* projectile: projectiles.getFriendlyProjectiles())
 		projectile->draw(projection_2D);
 	m_player->draw(projection_2D);
 	m_uiPanelBackground->draw(projection_2D);
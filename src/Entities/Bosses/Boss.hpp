@@ -57,6 +57,10 @@ public:
     virtual vec2 get_bounding_box() const = 0;
 
     virtual bool checkCollision(vec2 pos, vec2 box) const = 0;
+    // checkCollision as a CollisionComponent complex test
+    static bool collisionTest(const ECS::Entity& self, vec2 pos, vec2 box) {
+        return static_cast<const Boss&>(self).checkCollision(pos, box);
+    }
 
     std::vector<Projectile*> projectiles;
 	std::vector<Clone*> clones;
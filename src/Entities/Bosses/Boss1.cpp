@@ -10,6 +10,7 @@
 #include <Components/PhysicsComponent.hpp>
 #include <Components/MotionComponent.hpp>
 #include <Components/TransformComponent.hpp>
+#include <Components/CollisionComponent.hpp>
 
 // Same as static in c, local to compilation unit
 namespace
@@ -35,6 +36,7 @@ bool Boss1::init(vec2 screen) {
     auto* physics = addComponent<PhysicsComponent>();
     auto* motion = addComponent<MotionComponent>();
     auto* transform = addComponent<TransformComponent>();
+    auto* collision = addComponent<CollisionComponent>();
 
     // Load shared texture
     if (!boss1_texture.is_valid())
@@ -64,6 +66,10 @@ bool Boss1::init(vec2 screen) {
     // Setting initial values, scale is negative to make it face the opposite way
     // 1.0 would be as big as the original texture.
     physics->scale = { -0.4f, 0.4f };
+    collision->setClass(CollisionClass::Boss);
+    // The circle checkCollision tests reaches 0.4 * the larger side in every direction
+    float side = std::max(get_bounding_box().x, get_bounding_box().y);
+    collision->setComplex(Boss::collisionTest, { side, side });
 
     health = INIT_HEALTH;
     m_is_alive = true;
@@ -179,11 +185,7 @@ void Boss1::draw(const mat3 &projection) {
     auto* physics = getComponent<PhysicsComponent>();
     auto* sprite = getComponent<SpriteComponent>();
 
-    transform->begin();
-    transform->translate(motion->position);
-    transform->scale(physics->scale);
-    transform->rotate(motion->radians);
-    transform->end();
+    transform->set(motion->renderPosition, physics->scale, motion->radians);
 
     float mod = 1;
     if (m_damage_effect_cooldown > 0)
@@ -213,12 +215,9 @@ vec2 Boss1::get_bounding_box() const {
 
 void Boss1::spawnBullet() {
     auto* motion = getComponent<MotionComponent>();
-    Bullet* bullet = &GameEngine::getInstance().getEntityManager()->addEntity<Bullet>();
-    if (bullet->init(motion->position, motion->radians+ 3.14f, true, BULLET_DAMAGE)) {
-        projectiles.emplace_back(bullet);
-    } else {
-        throw std::runtime_error("Failed to spawn bullet");
-    }
+    Bullet* bullet = &GameEngine::getInstance().getEntityManager()->getCommands().instantiate<Bullet>();
+    bullet->launch(motion->position, motion->radians+ 3.14f, true, BULLET_DAMAGE);
+    projectiles.emplace_back(bullet);
 }
 
 void Boss1::addDamage(int damage) {
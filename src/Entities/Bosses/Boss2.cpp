@@ -8,6 +8,7 @@
 #include <Components/PhysicsComponent.hpp>
 #include <Components/MotionComponent.hpp>
 #include <Components/TransformComponent.hpp>
+#include <Components/CollisionComponent.hpp>
 #include <Entities/Projectiles and Damaging/Laser/Laser.hpp>
 #include <Systems/EnemySpawnerSystem.hpp>
 #include <chrono>
@@ -240,6 +241,7 @@ bool Boss2::init(vec2 screen) {
     auto* physics = addComponent<PhysicsComponent>();
     auto* motion = addComponent<MotionComponent>();
     auto* transform = addComponent<TransformComponent>();
+    auto* collision = addComponent<CollisionComponent>();
 
     // Load shared texture
     if (!boss2_texture.is_valid())
@@ -305,6 +307,10 @@ bool Boss2::init(vec2 screen) {
     // Setting initial values, scale is negative to make it face the opposite way
     // 1.0 would be as big as the original texture.
     physics->scale = SPRITE_SCALE;
+    collision->setClass(CollisionClass::Boss);
+    // Same box checkCollision tests before checking the outline
+    collision->setComplex(Boss::collisionTest, { (std::fabs(physics->scale.x) + 0.1f) * SPRITE_W,
+                                                 (std::fabs(physics->scale.y) + 0.1f) * SPRITE_H });
 
     health = INIT_HEALTH;
     m_is_alive = true;
@@ -464,11 +470,7 @@ void Boss2::draw(const mat3 &projection) {
     auto* physics = getComponent<PhysicsComponent>();
     auto* sprite = getComponent<SpriteComponent>();
 
-    transform->begin();
-    transform->translate(motion->position);
-    transform->scale(physics->scale);
-    transform->rotate(motion->radians);
-    transform->end();
+    transform->set(motion->renderPosition, physics->scale, motion->radians);
 
     float mod = 1;
     if (m_damage_effect_cooldown > 0)
@@ -482,11 +484,7 @@ void Boss2::draw(const mat3 &projection) {
     if (GameEngine::getInstance().getM_debug_mode()){
         // Vertex Debug Drawing
         for (auto& vertex : m_vertices) {
-            transform->begin();
-            transform->translate(motion->position);
-            transform->scale(MESH_SCALE);
-            transform->rotate(motion->radians + 1.5708f);
-            transform->end();
+            transform->set(motion->renderPosition, MESH_SCALE, motion->radians + 1.5708f);
 
             vec3 pos = mul(transform->out, vec3{vertex.position.x, vertex.position.y, 1.0});
             m_dot.draw(projection, {1.f,1.f,1.f}, {pos.x, pos.y}, 0);
@@ -535,11 +533,7 @@ bool Boss2::collidesWith(Player &player) {
         // Find the larges x and y collisions
         vec2 offset = {0,0};
         for(auto vertex : m_vertices) {
-            transform->begin();
-            transform->translate(motion->position);
-            transform->scale(MESH_SCALE);
-            transform->rotate(motion->radians + 1.5708f);
-            transform->end();
+            transform->set(motion->position, MESH_SCALE, motion->radians + 1.5708f);
             vec3 vpos = mul(transform->out, vec3{vertex.position.x, vertex.position.y, 1.0});
             float w = player_box.x/2;
             float h = player_box.y/2;
@@ -612,11 +606,7 @@ bool Boss2::checkCollision(vec2 pos, vec2 box) const {
     auto* transform = getComponent<TransformComponent>();
     // For each vertex, check if within the area
     for(auto vertex : m_vertices) {
-        transform->begin();
-        transform->translate(motion->position);
-        transform->scale(MESH_SCALE);
-        transform->rotate(motion->radians + 1.5708f);
-        transform->end();
+        transform->set(motion->position, MESH_SCALE, motion->radians + 1.5708f);
         vec3 vpos = mul(transform->out, vec3{vertex.position.x, vertex.position.y, 1.0});
         float w = box.x/2;
         float h = box.y/2;
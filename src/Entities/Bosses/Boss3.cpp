@@ -10,6 +10,7 @@
 #include <Components/PhysicsComponent.hpp>
 #include <Components/MotionComponent.hpp>
 #include <Components/TransformComponent.hpp>
+#include <Components/CollisionComponent.hpp>
 
 namespace
 {
@@ -41,6 +42,7 @@ bool Boss3::init(vec2 screen) {
 	auto* physics = addComponent<PhysicsComponent>();
 	auto* motion = addComponent<MotionComponent>();
 	auto* transform = addComponent<TransformComponent>();
+	auto* collision = addComponent<CollisionComponent>();
 
 	// Load shared texture
 	if (!boss3_texture.is_valid())
@@ -69,6 +71,10 @@ bool Boss3::init(vec2 screen) {
 	// Setting initial values, scale is negative to make it face the opposite way
 	// 1.0 would be as big as the original texture.
 	physics->scale = { -0.35f, 0.35f };
+	collision->setClass(CollisionClass::Boss);
+	// The circle checkCollision tests reaches 0.4 * the larger side in every direction
+	float side = std::max(get_bounding_box().x, get_bounding_box().y);
+	collision->setComplex(Boss::collisionTest, { side, side });
 
 	health = INIT_HEALTH;
 	m_is_alive = true;
@@ -232,11 +238,7 @@ void Boss3::draw(const mat3 &projection) {
 	auto* physics = getComponent<PhysicsComponent>();
 	auto* sprite = getComponent<SpriteComponent>();
 
-	transform->begin();
-	transform->translate(motion->position);
-	transform->scale(physics->scale);
-	transform->rotate(motion->radians);
-	transform->end();
+	transform->set(motion->renderPosition, physics->scale, motion->radians);
 
 	float mod = 1;
 	if (m_damage_effect_cooldown > 0)
@@ -331,12 +333,8 @@ bool Boss3::nearBounds() {
 void Boss3::spawnBullet() {
 	auto& projectiles = GameEngine::getInstance().getSystemManager()->getSystem<ProjectileSystem>();
 	auto* motion = getComponent<MotionComponent>();
-	Bullet* bullet = &GameEngine::getInstance().getEntityManager()->addEntity<Bullet>();
-	if (bullet->init(motion->position, motion->radians + M_PI, true, BULLET_DAMAGE)) {
-		bullet->set_speed_slow();
-		projectiles.hostile_projectiles.emplace_back(bullet);
-	}
-	else {
-		throw std::runtime_error("Failed to spawn bullet");
-	}
+	Bullet* bullet = &GameEngine::getInstance().getEntityManager()->getCommands().instantiate<Bullet>();
+	bullet->launch(motion->position, motion->radians + M_PI, true, BULLET_DAMAGE);
+	bullet->set_speed_slow();
+	projectiles.spawn(bullet);
 }
\ No newline at end of file
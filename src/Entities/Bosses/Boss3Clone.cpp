@@ -10,6 +10,7 @@
 #include <Components/PhysicsComponent.hpp>
 #include <Components/MotionComponent.hpp>
 #include <Components/TransformComponent.hpp>
+#include <Components/CollisionComponent.hpp>
 #include <Entities/Projectiles and Damaging/bullet.hpp>
 #include <Engine/GameEngine.hpp>
 #include <Components/EnemyComponent.hpp>
@@ -33,6 +34,7 @@ bool Boss3Clone::init(vec2 pos, vec2 disp) {
     auto* motion = addComponent<MotionComponent>();
     auto* enemy = addComponent<EnemyComponent>();
     auto* transform = addComponent<TransformComponent>();
+    auto* collision = addComponent<CollisionComponent>();
 
     // Load shared texture
     if (!texture.is_valid())
@@ -66,6 +68,10 @@ bool Boss3Clone::init(vec2 pos, vec2 disp) {
     // Setting initial values, scale is negative to make it face the opposite way
     // 1.0 would be as big as the original texture.
     physics->scale = { -0.2f, 0.2f };
+    collision->setClass(CollisionClass::Clone);
+    // The circle checkCollision tests reaches 0.4 * the larger side in every direction
+    float side = std::max(get_bounding_box().x, get_bounding_box().y);
+    collision->setComplex(Clone::collisionTest, { side, side });
 
     m_burst_count = 0;
     m_burst_cooldown = BURST_COOLDOWN_MS;
@@ -150,11 +156,7 @@ void Boss3Clone::draw(const mat3 &projection) {
     auto* physics = getComponent<PhysicsComponent>();
     auto* sprite = getComponent<SpriteComponent>();
 
-    transform->begin();
-    transform->translate(motion->position);
-    transform->scale(physics->scale);
-    transform->rotate(motion->radians);
-    transform->end();
+    transform->set(motion->renderPosition, physics->scale, motion->radians);
 
     sprite->draw(projection, transform->out, effect->program);
 }
@@ -213,13 +215,10 @@ void Boss3Clone::set_velocity(vec2 velocity) {
 void Boss3Clone::spawnBullet() {
     auto & projectiles = GameEngine::getInstance().getSystemManager()->getSystem<ProjectileSystem>();
     auto* motion = getComponent<MotionComponent>();
-    Bullet* bullet = &GameEngine::getInstance().getEntityManager()->addEntity<Bullet>();
-    if (bullet->init(motion->position, motion->radians + 3.14f, true, BULLET_DAMAGE)) {
-		bullet->set_speed_slow();
-        projectiles.hostile_projectiles.emplace_back(bullet);
-    } else {
-        throw std::runtime_error("Failed to spawn bullet");
-    }
+    Bullet* bullet = &GameEngine::getInstance().getEntityManager()->getCommands().instantiate<Bullet>();
+    bullet->launch(motion->position, motion->radians + 3.14f, true, BULLET_DAMAGE);
+    bullet->set_speed_slow();
+    projectiles.spawn(bullet);
 }
 
 vec2 Boss3Clone::move_to(vec2 target, float speed) {
@@ -20,10 +20,13 @@ public:
     virtual void update(float ms) {};
     virtual void draw(const mat3& projection) {};
     virtual void destroy() {};
-    virtual void collideWith(const char* typeName, const Entity& other) {};
 	virtual bool collidesWith(Player& player) = 0;
 	virtual bool collidesWith(Vamp& vamp) = 0;
 	virtual bool checkCollision(vec2 pos, vec2 box) const = 0;
+	// checkCollision as a CollisionComponent complex test
+	static bool collisionTest(const ECS::Entity& self, vec2 pos, vec2 box) {
+		return static_cast<const Clone&>(self).checkCollision(pos, box);
+	}
     virtual void set_position(vec2 pos) {};
     virtual void set_velocity(vec2 vel) {};
     virtual vec2 get_position()const { return  { 0.f,0.f }; };
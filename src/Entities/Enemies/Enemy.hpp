@@ -12,7 +12,6 @@ public:
     virtual void update(float ms) {};
     virtual void draw(const mat3& projection) {};
     virtual void destroy() {};
-    virtual void collideWith(const char* typeName, const Entity& other) {};
     virtual void set_position(vec2 pos) {};
     virtual void set_velocity(vec2 vel) {};
     virtual vec2 get_position()const { return  { 0.f,0.f }; };
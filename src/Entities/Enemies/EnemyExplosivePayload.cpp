@@ -13,6 +13,7 @@
 #include <Entities/Projectiles and Damaging/bullet.hpp>
 #include <Engine/GameEngine.hpp>
 #include <Components/EnemyComponent.hpp>
+#include <Components/CollisionComponent.hpp>
 #include <Systems/ProjectileSystem.hpp>
 
 Texture EnemyExplosivePlayload::texture;
@@ -34,6 +35,7 @@ bool EnemyExplosivePlayload::init() {
     auto* motion = addComponent<MotionComponent>();
     auto* enemy = addComponent<EnemyComponent>();
     auto* transform = addComponent<TransformComponent>();
+    auto* collision = addComponent<CollisionComponent>();
 
     // Load shared texture
     if (!texture.is_valid())
@@ -62,6 +64,8 @@ bool EnemyExplosivePlayload::init() {
     // Setting initial values, scale is negative to make it face the opposite way
     // 1.0 would be as big as the original texture.
     physics->scale = { -0.23f, 0.23f };
+    collision->setClass(CollisionClass::Enemy);
+    collision->setRadius(get_bounding_box(), 0.6f);
 
     m_explosive_cooldown_ms = EXPLOSVE_TIME_MS;
     m_rotation_direction = 1.0;
@@ -117,11 +121,7 @@ void EnemyExplosivePlayload::draw(const mat3 &projection) {
     auto* physics = getComponent<PhysicsComponent>();
     auto* sprite = getComponent<SpriteComponent>();
 
-    transform->begin();
-    transform->translate(motion->position);
-    transform->scale(physics->scale);
-    transform->rotate(motion->radians);
-    transform->end();
+    transform->set(motion->renderPosition, physics->scale, motion->radians);
 
     sprite->draw(projection, transform->out, effect->program);
 }
@@ -155,12 +155,9 @@ void EnemyExplosivePlayload::spawnPayloadBullets() {
     auto* motion = getComponent<MotionComponent>();
 
     for(int i = 0; i < PAYLOAD_BULLET_COUNT; i++) {
-        Bullet *bullet = &GameEngine::getInstance().getEntityManager()->addEntity<Bullet>();
-        if (bullet->init(motion->position, ((3.14f * 2)/PAYLOAD_BULLET_COUNT) * i, true, BULLET_DAMAGE)) {
-            projectiles.hostile_projectiles.emplace_back(bullet);
-        } else {
-            throw std::runtime_error("Failed to spawn bullet");
-        }
+        Bullet *bullet = &GameEngine::getInstance().getEntityManager()->getCommands().instantiate<Bullet>();
+        bullet->launch(motion->position, ((3.14f * 2)/PAYLOAD_BULLET_COUNT) * i, true, BULLET_DAMAGE);
+        projectiles.spawn(bullet);
     }
 }
 
@@ -13,6 +13,7 @@
 #include <Entities/Projectiles and Damaging/bullet.hpp>
 #include <Engine/GameEngine.hpp>
 #include <Components/EnemyComponent.hpp>
+#include <Components/CollisionComponent.hpp>
 #include <Systems/ProjectileSystem.hpp>
 
 Texture EnemyGenericShooter::texture;
@@ -33,6 +34,7 @@ bool EnemyGenericShooter::init() {
     auto* motion = addComponent<MotionComponent>();
     auto* enemy = addComponent<EnemyComponent>();
     auto* transform = addComponent<TransformComponent>();
+    auto* collision = addComponent<CollisionComponent>();
 
     // Load shared texture
     if (!texture.is_valid())
@@ -61,6 +63,8 @@ bool EnemyGenericShooter::init() {
     // Setting initial values, scale is negative to make it face the opposite way
     // 1.0 would be as big as the original texture.
     physics->scale = { -0.28f, 0.28f };
+    collision->setClass(CollisionClass::Enemy);
+    collision->setRadius(get_bounding_box(), 0.6f);
 
     m_burst_count = 0;
     m_burst_cooldown = BURST_COOLDOWN_MS;
@@ -104,11 +108,7 @@ void EnemyGenericShooter::draw(const mat3 &projection) {
     auto* physics = getComponent<PhysicsComponent>();
     auto* sprite = getComponent<SpriteComponent>();
 
-    transform->begin();
-    transform->translate(motion->position);
-    transform->scale(physics->scale);
-    transform->rotate(motion->radians);
-    transform->end();
+    transform->set(motion->renderPosition, physics->scale, motion->radians);
 
     sprite->draw(projection, transform->out, effect->program);
 }
@@ -140,10 +140,7 @@ void EnemyGenericShooter::set_velocity(vec2 velocity) {
 void EnemyGenericShooter::spawnBullet() {
     auto & projectiles = GameEngine::getInstance().getSystemManager()->getSystem<ProjectileSystem>();
     auto* motion = getComponent<MotionComponent>();
-    Bullet* bullet = &GameEngine::getInstance().getEntityManager()->addEntity<Bullet>();
-    if (bullet->init(motion->position, motion->radians + 3.14f, true, BULLET_DAMAGE)) {
-        projectiles.hostile_projectiles.emplace_back(bullet);
-    } else {
-        throw std::runtime_error("Failed to spawn bullet");
-    }
+    Bullet* bullet = &GameEngine::getInstance().getEntityManager()->getCommands().instantiate<Bullet>();
+    bullet->launch(motion->position, motion->radians + 3.14f, true, BULLET_DAMAGE);
+    projectiles.spawn(bullet);
 }
\ No newline at end of file
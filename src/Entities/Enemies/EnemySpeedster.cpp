@@ -13,6 +13,7 @@
 #include <Entities/Projectiles and Damaging/bullet.hpp>
 #include <Engine/GameEngine.hpp>
 #include <Components/EnemyComponent.hpp>
+#include <Components/CollisionComponent.hpp>
 #include <Systems/ProjectileSystem.hpp>
 
 Texture EnemySpeedster::texture;
@@ -34,6 +35,7 @@ bool EnemySpeedster::init() {
     auto* motion = addComponent<MotionComponent>();
     auto* enemy = addComponent<EnemyComponent>();
     auto* transform = addComponent<TransformComponent>();
+    auto* collision = addComponent<CollisionComponent>();
 
     // Load shared texture
     if (!texture.is_valid())
@@ -62,6 +64,8 @@ bool EnemySpeedster::init() {
     // Setting initial values, scale is negative to make it face the opposite way
     // 1.0 would be as big as the original texture.
     physics->scale = { -0.35f, 0.35f };
+    collision->setClass(CollisionClass::Enemy);
+    collision->setRadius(get_bounding_box(), 0.6f);
 
     m_stationary_cooldown_ms = STATIONARY_TIME_MS;
     m_direction = from_top;
@@ -150,11 +154,7 @@ void EnemySpeedster::draw(const mat3 &projection) {
     auto* physics = getComponent<PhysicsComponent>();
     auto* sprite = getComponent<SpriteComponent>();
 
-    transform->begin();
-    transform->translate(motion->position);
-    transform->scale(physics->scale);
-    transform->rotate(motion->radians);
-    transform->end();
+    transform->set(motion->renderPosition, physics->scale, motion->radians);
 
     sprite->draw(projection, transform->out, effect->program);
 }
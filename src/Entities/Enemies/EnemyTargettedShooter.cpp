@@ -13,6 +13,7 @@
 #include <Entities/Projectiles and Damaging/bullet.hpp>
 #include <Engine/GameEngine.hpp>
 #include <Components/EnemyComponent.hpp>
+#include <Components/CollisionComponent.hpp>
 #include <Systems/ProjectileSystem.hpp>
 
 Texture EnemyTargettedShooter::texture;
@@ -33,6 +34,7 @@ bool EnemyTargettedShooter::init() {
     auto* physics = addComponent<PhysicsComponent>();
     auto* motion = addComponent<MotionComponent>();
     auto* transform = addComponent<TransformComponent>();
+    auto* collision = addComponent<CollisionComponent>();
 
     // Load shared texture
     if (!texture.is_valid())
@@ -61,6 +63,8 @@ bool EnemyTargettedShooter::init() {
     // Setting initial values, scale is negative to make it face the opposite way
     // 1.0 would be as big as the original texture.
     physics->scale = { -0.28f, 0.28f };
+    collision->setClass(CollisionClass::Enemy);
+    collision->setRadius(get_bounding_box(), 0.6f);
 
     m_burst_count = 0;
     m_burst_cooldown = BURST_COOLDOWN_MS;
@@ -137,11 +141,7 @@ void EnemyTargettedShooter::draw(const mat3 &projection) {
     auto* sprite = getComponent<SpriteComponent>();
     auto* enemy = addComponent<EnemyComponent>();
 
-    transform->begin();
-    transform->translate(motion->position);
-    transform->scale(physics->scale);
-    transform->rotate(motion->radians);
-    transform->end();
+    transform->set(motion->renderPosition, physics->scale, motion->radians);
 
     sprite->draw(projection, transform->out, effect->program);
 }
@@ -173,11 +173,8 @@ void EnemyTargettedShooter::set_velocity(vec2 velocity) {
 void EnemyTargettedShooter::spawnBullet() {
     auto & projectiles = GameEngine::getInstance().getSystemManager()->getSystem<ProjectileSystem>();
     auto *motion = getComponent<MotionComponent>();
-    Bullet *bullet = &GameEngine::getInstance().getEntityManager()->addEntity<Bullet>();
-    if (bullet->init(motion->position, motion->radians + M_PI, true, BULLET_DAMAGE)) {
-        bullet->set_speed_slow();
-        projectiles.hostile_projectiles.emplace_back(bullet);
-    } else {
-        throw std::runtime_error("Failed to spawn bullet");
-    }
+    Bullet *bullet = &GameEngine::getInstance().getEntityManager()->getCommands().instantiate<Bullet>();
+    bullet->launch(motion->position, motion->radians + M_PI, true, BULLET_DAMAGE);
+    bullet->set_speed_slow();
+    projectiles.spawn(bullet);
 }
@@ -10,6 +10,7 @@
 #include <Components/MotionComponent.hpp>
 #include <Components/TransformComponent.hpp>
 #include <Components/EnemyComponent.hpp>
+#include <Components/CollisionComponent.hpp>
 #include <Entities/Pickups/Pickup.hpp>
 #include <Entities/Pickups/TriShotPickup.hpp>
 #include <Entities/Pickups/MachineGunPickup.hpp>
@@ -33,6 +34,7 @@ bool PickupEnemy::init()
 	auto* motion = addComponent<MotionComponent>();
 	auto* transform = addComponent<TransformComponent>();
 	auto* enemy = addComponent<EnemyComponent>();
+	auto* collision = addComponent<CollisionComponent>();
 
 
 	// Load shared texture
@@ -62,6 +64,8 @@ bool PickupEnemy::init()
 	// Setting initial values, scale is negative to make it face the opposite way
 	// 1.0 would be as big as the original texture.
 	physics->scale = { -0.14f, 0.14f };
+	collision->setClass(CollisionClass::Enemy);
+	collision->setRadius(get_bounding_box(), 0.6f);
 	points = POINTS_VAL;
 
 	std::random_device rd;
@@ -71,6 +75,16 @@ bool PickupEnemy::init()
 	return true;
 }
 
+void PickupEnemy::onInstantiate()
+{
+	auto* motion = getComponent<MotionComponent>();
+	motion->radians = (rand() % 4) * 3.14f / 4;
+
+	std::random_device rd;
+	m_rand = std::default_random_engine(rd());
+	m_rand.seed(std::chrono::system_clock::now().time_since_epoch().count());
+}
+
 // Releases all graphics resources
 void PickupEnemy::destroy()
 {
@@ -100,11 +114,7 @@ void PickupEnemy::draw(const mat3& projection)
 	auto* physics = getComponent<PhysicsComponent>();
 	auto* sprite = getComponent<SpriteComponent>();
 
-	transform->begin();
-	transform->translate(motion->position);
-	transform->scale(physics->scale);
-	transform->rotate(motion->radians);
-	transform->end();
+	transform->set(motion->renderPosition, physics->scale, motion->radians);
 
 	sprite->draw(projection, transform->out, effect->program);
 }
@@ -148,31 +158,31 @@ void PickupEnemy::spawn_pickup() {
         case 0: {
             auto *p = &e->addEntity<HealthPickup>();
             p->init(motion->position);
-            ps.pickups.emplace_back(p);
+            ps.add(p);
             break;
         }
         case 1:{
             auto *p = &e->addEntity<MachineGunPickup>();
             p->init(motion->position);
-            ps.pickups.emplace_back(p);
+            ps.add(p);
             break;
         }
         case 2:{
             auto *p = &e->addEntity<TriShotPickup>();
             p->init(motion->position);
-            ps.pickups.emplace_back(p);
+            ps.add(p);
             break;
         }
         case 3:{
             auto *p = &e->addEntity<VampExpandPickup>();
             p->init(motion->position);
-            ps.pickups.emplace_back(p);
+            ps.add(p);
             break;
         }
         default:{
             auto *p = &e->addEntity<HealthPickup>();
             p->init(motion->position);
-            ps.pickups.emplace_back(p);
+            ps.add(p);
             break;
         }
     }
@@ -12,6 +12,9 @@ public:
 // Creates all the associated render resources and default transform
 	bool init() override;
 
+	// Randomizes the starting rotation and reseeds the pickup drops of each spawned enemy
+	void onInstantiate() override;
+
 	// Releases all the associated resources
 	void destroy() override;
 
@@ -8,6 +8,7 @@
 #include <Components/MotionComponent.hpp>
 #include <Components/TransformComponent.hpp>
 #include <Components/EnemyComponent.hpp>
+#include <Components/CollisionComponent.hpp>
 
 Texture Turtle::turtle_texture;
 
@@ -23,6 +24,7 @@ bool Turtle::init()
 	auto* motion = addComponent<MotionComponent>();
 	auto* transform = addComponent<TransformComponent>();
 	auto* enemy = addComponent<EnemyComponent>();
+	auto* collision = addComponent<CollisionComponent>();
 
 	// Load shared texture
 	if (!turtle_texture.is_valid())
@@ -51,11 +53,19 @@ bool Turtle::init()
 	// Setting initial values, scale is negative to make it face the opposite way
 	// 1.0 would be as big as the original texture.
 	physics->scale = { -0.28f, 0.28f };
+	collision->setClass(CollisionClass::Enemy);
+	collision->setRadius(get_bounding_box(), 0.6f);
 	points = POINTS_VAL;
 
 	return true;
 }
 
+void Turtle::onInstantiate()
+{
+	auto* motion = getComponent<MotionComponent>();
+	motion->radians = (rand() % 4) * 3.14f / 4;
+}
+
 // Releases all graphics resources
 void Turtle::destroy()
 {
@@ -83,11 +93,7 @@ void Turtle::draw(const mat3& projection)
 	auto* physics = getComponent<PhysicsComponent>();
 	auto* sprite = getComponent<SpriteComponent>();
 
-	transform->begin();
-	transform->translate(motion->position);
-	transform->scale(physics->scale);
-	transform->rotate(motion->radians);
-	transform->end();
+	transform->set(motion->renderPosition, physics->scale, motion->radians);
 
 	sprite->draw(projection, transform->out, effect->program);
 }
@@ -19,14 +19,23 @@ bool EntityGrid::init(int width, int height, int size) {
     gridH = (int)std::ceil((float)height / (float)size);
     this->size = size;
 
-    // Generate EType grid
-    for (int i = 0; i < gridW; ++i) {
-        std::vector<EType> row;
-        for (int j = 0; j < gridH; ++j) {
-            row.emplace_back(EType::empty);
-        }
-        grid.emplace_back(row);
-    }
+    // Generate EType occupancy, bitplanes and area tables
+    planeWords = (gridW * gridH + 63) / 64;
+    occupancy.assign((size_t)(ETYPE_COUNT * gridW * gridH), 0);
+    planes.assign((size_t)(ETYPE_COUNT * planeWords), 0);
+    areaTables.assign((size_t)(ETYPE_COUNT * (gridW + 1) * (gridH + 1)), 0);
+    planeDirty.reset();
+    footprints.clear();
+    dirty.clear();
+
+    // Search scratch, stamped per search so it's only allocated here
+    nodes.assign((size_t)(gridW * gridH), Node());
+    generation = 0;
+    open.clear();
+    open.reserve((size_t)(gridW * gridH));
+    flowCost.assign((size_t)(gridW * gridH), std::numeric_limits<float>::max());
+    flowNext.assign((size_t)(gridW * gridH), -1);
+    flowTarget = -1;
 
     // Generate grid vertices
     for (int i=0; i < gridW+1; ++i) {
@@ -98,13 +107,78 @@ void EntityGrid::destroy() {
 
 // Set all squares as emtpy
 void EntityGrid::clear() {
+    std::fill(occupancy.begin(), occupancy.end(), 0);
+    std::fill(planes.begin(), planes.end(), 0);
+    std::fill(areaTables.begin(), areaTables.end(), 0);
+    planeDirty.reset();
+    footprints.clear();
+    dirty.push_back({0, 0, gridW, gridH});
+}
+
+void EntityGrid::beginUpdate() {
+    frame++;
+    dirty.clear();
+}
+
+// Removes entities that weren't added since beginUpdate
+void EntityGrid::endUpdate() {
+    for (auto it = footprints.begin(); it != footprints.end();) {
+        if (it->second.frame != frame) {
+            occupy(it->second.rect, it->second.type, -1);
+            it = footprints.erase(it);
+        } else {
+            ++it;
+        }
+    }
+
+    // Area tables of the types whose squares changed
+    for (int type = 0; type < ETYPE_COUNT; type++) {
+        if (planeDirty[type]) buildAreaTable((EType)type);
+    }
+    planeDirty.reset();
+}
+
+// Summed-area table of a type's bitplane, table[x*(gridH+1)+y] counts the type's squares in [0,x) x [0,y)
+void EntityGrid::buildAreaTable(EType type) {
+    const uint64_t* plane = &planes[type * planeWords];
+    int* table = &areaTables[type * (gridW + 1) * (gridH + 1)];
+    int stride = gridH + 1;
     for (int x = 0; x < gridW; x++) {
+        int column = 0;
         for (int y = 0; y < gridH; y++) {
-            grid[x][y] = EType::empty;
+            int index = x * gridH + y;
+            column += (int)((plane[index / 64] >> (index % 64)) & 1u);
+            table[(x + 1) * stride + y + 1] = table[x * stride + y + 1] + column;
         }
     }
 }
 
+// Number of squares in rect holding type, four lookups
+int EntityGrid::countIn(const GridRect& rect, EType type) const {
+    const int* table = &areaTables[type * (gridW + 1) * (gridH + 1)];
+    int stride = gridH + 1;
+    return table[rect.r * stride + rect.b] - table[rect.l * stride + rect.b]
+         - table[rect.r * stride + rect.t] + table[rect.l * stride + rect.t];
+}
+
+bool EntityGrid::has(int x, int y, EType type) const {
+    int index = x * gridH + y;
+    return ((planes[type * planeWords + index / 64] >> (index % 64)) & 1u) != 0;
+}
+
+// Order squares are drawn over each other in, the last type present is drawn
+static const EType typeOrder[] = {
+        EType::enemy, EType::projectile_hostile, EType::vamp, EType::player, EType::projectile_friendly, EType::goal
+};
+
+EType EntityGrid::typeAt(int x, int y) const {
+    EType top = EType::empty;
+    for (auto candidate : typeOrder) {
+        if (has(x, y, candidate)) top = candidate;
+    }
+    return top;
+}
+
 void EntityGrid::addToGrid(const Player &player) {
     vec2 box = player.get_bounding_box();
     vec2 pos = player.get_position();
@@ -115,7 +189,7 @@ void EntityGrid::addToGrid(const Player &player) {
     vec2 br = {pos.x+w, pos.y+h};
 
 
-    addBoxToGrid(tl, br, EType::player);
+    addBoxToGrid(&player, tl, br, EType::player);
 }
 
 void EntityGrid::addToGrid(const Vamp &vamp) {
@@ -128,7 +202,7 @@ void EntityGrid::addToGrid(const Vamp &vamp) {
     vec2 br = {pos.x+w, pos.y+h};
 
 
-    addBoxToGrid(tl, br, EType::vamp);
+    addBoxToGrid(&vamp, tl, br, EType::vamp);
 }
 
 void EntityGrid::addToGrid(const Pickup &pickup) {
@@ -141,7 +215,7 @@ void EntityGrid::addToGrid(const Pickup &pickup) {
     vec2 br = {pos.x+w, pos.y+h};
 
 
-    addBoxToGrid(tl, br, EType::goal);
+    addBoxToGrid(&pickup, tl, br, EType::goal);
 }
 
 void EntityGrid::addToGrid(const Enemy &enemy) {
@@ -154,7 +228,7 @@ void EntityGrid::addToGrid(const Enemy &enemy) {
     vec2 br = {pos.x+w, pos.y+h};
 
 
-    addBoxToGrid(tl, br, EType::enemy);
+    addBoxToGrid(&enemy, tl, br, EType::enemy);
 }
 
 void EntityGrid::addToGrid(const Boss &boss) {
@@ -167,7 +241,7 @@ void EntityGrid::addToGrid(const Boss &boss) {
     vec2 br = {pos.x+w, pos.y+h};
 
 
-    addBoxToGrid(tl, br, EType::enemy);
+    addBoxToGrid(&boss, tl, br, EType::enemy);
 }
 
 void EntityGrid::addToGrid(const Projectile &projectile) {
@@ -188,28 +262,81 @@ void EntityGrid::addToGrid(const Projectile &projectile) {
     }
 
 
-    addBoxToGrid(tl, br, type);
+    addBoxToGrid(&projectile, tl, br, type);
 }
 
 int bound(int val, int low, int hi) {
     return std::max(low, std::min(val, hi));
 }
 
-// Calculates which squares the box(tl,br) occupies, and sets as type
-void EntityGrid::addBoxToGrid(vec2 tl, vec2 br, EType type) {
+// Calculates which squares the box(tl,br) occupies, and moves key's footprint there
+void EntityGrid::addBoxToGrid(const void* key, vec2 tl, vec2 br, EType type) {
     auto l = bound((int)std::floor(tl.x / (float)size), 0, gridW);
     auto r = bound((int)std::ceil(br.x / (float)size), l, gridW);
     auto t = bound((int)std::floor(tl.y / (float)size), 0, gridH);
     auto b = bound((int)std::ceil(br.y / (float)size), t, gridH);
+    GridRect rect = {l, t, r, b};
+
+    auto it = footprints.find(key);
+    if (it == footprints.end()) {
+        footprints[key] = {rect, type, frame};
+        occupy(rect, type, 1);
+        return;
+    }
+
+    Footprint& footprint = it->second;
+    footprint.frame = frame;
+    if (footprint.type == type && footprint.rect.l == l && footprint.rect.r == r && footprint.rect.t == t && footprint.rect.b == b)
+        return;
 
+    if (footprint.type != type) {
+        occupy(footprint.rect, footprint.type, -1);
+        occupy(rect, type, 1);
+    } else {
+        occupyDifference(footprint.rect, rect, type, -1);
+        occupyDifference(rect, footprint.rect, type, 1);
+    }
+    footprint.rect = rect;
+    footprint.type = type;
+}
 
-    for (int x = l; x < r; x++) {
-        for (int y = t; y < b; y++) {
-            grid[x][y] = type;
+void EntityGrid::occupy(const GridRect& rect, EType type, int delta) {
+    if (rect.l >= rect.r || rect.t >= rect.b) return;
+    dirty.push_back(rect);
+
+    uint64_t* plane = &planes[type * planeWords];
+    for (int x = rect.l; x < rect.r; x++) {
+        for (int y = rect.t; y < rect.b; y++) {
+            int index = x * gridH + y;
+            uint16_t& count = occupancy[index * ETYPE_COUNT + type];
+            count += delta;
+            // The type's bit only changes when it appears or disappears from the square
+            if (count > 1 || (count == 1 && delta < 0)) continue;
+
+            uint64_t bit = (uint64_t)1 << (index % 64);
+            if (count > 0) plane[index / 64] |= bit;
+            else plane[index / 64] &= ~bit;
+            planeDirty[type] = true;
         }
     }
 }
 
+// Splits from - to into at most four rects, above, below, left and right of their overlap
+void EntityGrid::occupyDifference(const GridRect& from, const GridRect& to, EType type, int delta) {
+    int l = std::max(from.l, to.l);
+    int r = std::min(from.r, to.r);
+    int t = std::max(from.t, to.t);
+    int b = std::min(from.b, to.b);
+    if (l >= r || t >= b) {
+        occupy(from, type, delta);
+        return;
+    }
+    occupy({from.l, from.t, from.r, t}, type, delta);
+    occupy({from.l, b, from.r, from.b}, type, delta);
+    occupy({from.l, t, l, b}, type, delta);
+    occupy({r, t, from.r, b}, type, delta);
+}
+
 
 void EntityGrid::draw(const mat3 &projection) {
     transform.begin();
@@ -257,29 +384,139 @@ void EntityGrid::draw(const mat3 &projection) {
     for (int i=0; i < gridW; ++i) {
         for (int j = 0; j < gridH; ++j) {
             Vertex v = m_vertices[i*(gridH+1)+j];
-            square.draw(projection, {v.position.x, v.position.y}, grid[i][j]);
+            square.draw(projection, {v.position.x, v.position.y}, typeAt(i, j));
         }
     }
 }
 
-bool isDestEnemy(const std::vector<std::vector<EType>>& grid, pair pos, pair dest) {
-    return pos.x == dest.x && pos.y == dest.y; // Turtle destination is the specific dest point (player);
-}
-float enemyH(const std::vector<std::vector<EType>>& grid, pair pos, pair dest) {
-    // Direct distance to player - admissible
-    return (float)(std::sqrt(std::pow((pos.x - dest.x), 2) + std::pow((pos.y - dest.y), 2) ));
-}
+struct EnemyDestination {
+    bool operator()(const EntityGrid& grid, pair pos, pair dest) const {
+        return pos.x == dest.x && pos.y == dest.y; // Enemy destination is the specific dest point (player)
+    }
+};
+struct EnemyHeuristic {
+    float operator()(const EntityGrid& grid, pair pos, pair dest) const {
+        // Direct distance to player - admissible
+        auto dx = (float)(pos.x - dest.x);
+        auto dy = (float)(pos.y - dest.y);
+        return std::sqrt(dx * dx + dy * dy);
+    }
+};
 
 std::vector<vec2> EntityGrid::getPath(const Enemy& enemy, const Player& player) {
-    vec2 tpos = enemy.get_position();
-    vec2 tbox = enemy.get_bounding_box();
+    return getPath(enemy.get_position(), enemy.get_bounding_box(), player.get_position(), {});
+}
 
-    vec2 spos = player.get_position();
-    auto sx = (int)std::floor((spos.x) / (float)size);
-    auto sy = (int)std::floor((spos.y) / (float)size);
+std::vector<vec2> EntityGrid::getPath(vec2 position, vec2 bbox, vec2 goal, const std::vector<EType>& avoid) {
+    auto sx = (int)std::floor((goal.x) / (float)size);
+    auto sy = (int)std::floor((goal.y) / (float)size);
     pair s = { sx, sy };
 
-    return search(tpos, tbox, {}, &isDestEnemy, &enemyH, s);
+    return search(position, bbox, avoid, EnemyDestination(), EnemyHeuristic(), s);
+}
+
+void EntityGrid::takeSnapshot(GridSnapshot& out) const {
+    out.gridW = gridW;
+    out.gridH = gridH;
+    out.size = size;
+    out.planeWords = planeWords;
+    out.planes = planes;
+    out.areaTables = areaTables;
+}
+
+// Replaces the occupancy with a snapshot's, entities added before are forgotten
+void EntityGrid::loadSnapshot(const GridSnapshot& in) {
+    if (in.gridW != gridW || in.gridH != gridH) {
+        gridW = in.gridW;
+        gridH = in.gridH;
+        nodes.assign((size_t)(gridW * gridH), Node());
+        generation = 0;
+        open.clear();
+        open.reserve((size_t)(gridW * gridH));
+        flowCost.assign((size_t)(gridW * gridH), std::numeric_limits<float>::max());
+        flowNext.assign((size_t)(gridW * gridH), -1);
+        occupancy.assign((size_t)(ETYPE_COUNT * gridW * gridH), 0);
+    }
+    size = in.size;
+    planeWords = in.planeWords;
+    planes = in.planes;
+    areaTables = in.areaTables;
+    planeDirty.reset();
+    footprints.clear();
+    flowTarget = -1;
+}
+
+// Reverse Dijkstra from the target's square, every square learns its cost to the target and the next square on the way.
+// Stepping into a square that isn't clear costs the same +100 as in search.
+void EntityGrid::updateFlowField(vec2 target, const std::vector<EType>& avoid, vec2 bbox) {
+    std::fill(flowCost.begin(), flowCost.end(), std::numeric_limits<float>::max());
+    std::fill(flowNext.begin(), flowNext.end(), -1);
+    flowTarget = squareAt(target);
+    if (flowTarget < 0) return;
+
+    auto w = (int)std::ceil(bbox.x / (float)size);
+    auto h = (int)std::ceil(bbox.y / (float)size);
+
+    // Heap ordered on lowest cost first
+    auto later = [](const std::pair<float, int>& a, const std::pair<float, int>& b) { return a.first > b.first; };
+    flowOpen.clear();
+    flowCost[flowTarget] = 0.f;
+    flowOpen.emplace_back(0.f, flowTarget);
+
+    while (!flowOpen.empty()) {
+        std::pop_heap(flowOpen.begin(), flowOpen.end(), later);
+        auto top = flowOpen.back();
+        flowOpen.pop_back();
+        int index = top.second;
+        // Stale entry, the square was reached cheaper since
+        if (top.first > flowCost[index]) continue;
+
+        int x = index / gridH;
+        int y = index % gridH;
+        // Cost for a neighbour to step into this square
+        float step = isClear(x, y, w, h, avoid) ? 1.f : 101.f;
+        float cost = flowCost[index] + step;
+
+        pair adjacent[4] = {{x-1,y}, {x,y-1}, {x+1, y}, {x, y+1}};
+        for (auto n : adjacent) {
+            if (!isValid(n.x, n.y)) continue;
+            int adj = n.x * gridH + n.y;
+            if (cost < flowCost[adj]) {
+                flowCost[adj] = cost;
+                flowNext[adj] = index;
+                flowOpen.emplace_back(cost, adj);
+                std::push_heap(flowOpen.begin(), flowOpen.end(), later);
+            }
+        }
+    }
+}
+
+std::vector<vec2> EntityGrid::getFlowPath(vec2 position) const {
+    int start = squareAt(position);
+    if (start < 0 || start == flowTarget || flowNext[start] < 0) {
+        return std::vector<vec2>();
+    }
+
+    // Keep offset for path generation
+    float offsetX = position.x - (float)(size * (start / gridH));
+    float offsetY = position.y - (float)(size * (start % gridH));
+
+    // Follow the field to the target, then reverse so the target's square comes first like search's paths
+    std::vector<vec2> path;
+    for (int p = flowNext[start]; p >= 0; p = flowNext[p]) {
+        path.push_back({ (float)((p / gridH) * size) + offsetX, (float)((p % gridH) * size) + offsetY });
+    }
+    std::reverse(path.begin(), path.end());
+    return path;
+}
+
+vec2 EntityGrid::getFlowDirection(vec2 position) const {
+    int square = squareAt(position);
+    if (square < 0 || flowNext[square] < 0) {
+        return {0.f, 0.f};
+    }
+    int next = flowNext[square];
+    return { (float)(next / gridH - square / gridH), (float)(next % gridH - square % gridH) };
 }
 
 /*
@@ -372,21 +609,98 @@ std::vector<vec2> EntityGrid::getPath(const Salmon &salmon, const std::vector<Fi
 
 
 // Debug printing node details
-void EntityGrid::printNode(Node node) {
+void EntityGrid::printNode(int index) const {
+    const Node& node = nodes[index];
     std::cout << "Node { " << std::endl;
-    std::cout <<"\tposition: (" << node.position.x << "," << node.position.y << ")," << std::endl;
-    std::cout <<"\tparent: (" << node.parent.x << "," << node.parent.y << ")," << std::endl;
-    std::cout <<"\tg=" << node.g << ", h=" << node.h << ", f=" << node.f << std::endl;
+    std::cout <<"\tposition: (" << index / gridH << "," << index % gridH << ")," << std::endl;
+    std::cout <<"\tparent: (" << node.parent / gridH << "," << node.parent % gridH << ")," << std::endl;
+    std::cout <<"\tg=" << node.g << ", f=" << node.f << std::endl;
     std::cout << "}" << std::endl;
 }
 
 // Check if x,y within grid
-bool EntityGrid::isValid(int x, int y) {
+bool EntityGrid::isValid(int x, int y) const {
     return !(x < 0 || x >= gridW || y < 0 || y >= gridH);
 }
 
+// Check for clearance
+bool EntityGrid::isClear(int x, int y, int w, int h, const std::vector<EType>& avoid) const {
+    if (avoid.empty()) return true;
+    GridRect rect = {
+            std::max((x - w/2), 0),
+            std::max((y - h/2), 0),
+            std::min((x + w/2 + 1), gridW),
+            std::min((y + h/2 + 1), gridH),
+    };
+    for (auto type : avoid) {
+        if (countIn(rect, type) > 0) return false;
+    }
+    return true;
+}
+
+int EntityGrid::squareAt(vec2 position) const {
+    auto x = (int)std::floor(position.x / (float)size);
+    auto y = (int)std::floor(position.y / (float)size);
+    return isValid(x, y) ? x * gridH + y : -1;
+}
+
+void EntityGrid::siftUp(int i) {
+    int index = open[i];
+    float f = nodes[index].f;
+    while (i > 0) {
+        int parent = (i - 1) / 2;
+        if (nodes[open[parent]].f <= f) break;
+        open[i] = open[parent];
+        nodes[open[i]].heapIndex = i;
+        i = parent;
+    }
+    open[i] = index;
+    nodes[index].heapIndex = i;
+}
+
+void EntityGrid::siftDown(int i) {
+    int index = open[i];
+    float f = nodes[index].f;
+    auto count = (int)open.size();
+    while (true) {
+        int child = 2 * i + 1;
+        if (child >= count) break;
+        if (child + 1 < count && nodes[open[child + 1]].f < nodes[open[child]].f) child++;
+        if (nodes[open[child]].f >= f) break;
+        open[i] = open[child];
+        nodes[open[i]].heapIndex = i;
+        i = child;
+    }
+    open[i] = index;
+    nodes[index].heapIndex = i;
+}
+
+// Adds a node to open, or moves it up if it's already open with a now lower f
+void EntityGrid::pushOpen(int index) {
+    if (nodes[index].heapIndex < 0) {
+        open.push_back(index);
+        siftUp((int)open.size() - 1);
+    } else {
+        siftUp(nodes[index].heapIndex);
+    }
+}
+
+// Removes and returns the open node with the lowest f
+int EntityGrid::popOpen() {
+    int index = open[0];
+    nodes[index].heapIndex = -1;
+    int last = open.back();
+    open.pop_back();
+    if (!open.empty()) {
+        open[0] = last;
+        siftDown(0);
+    }
+    return index;
+}
+
 // A* Search
-std::vector<vec2> EntityGrid::search(vec2 position, vec2 bbox, const std::vector<EType> avoid, isDestinationFn isDest, heuristicFn hfn, pair dest, bool DEBUG_LOG) {
+template <typename Destination, typename Heuristic>
+std::vector<vec2> EntityGrid::search(vec2 position, vec2 bbox, const std::vector<EType>& avoid, Destination isDest, Heuristic hfn, pair dest, bool DEBUG_LOG) {
     // Caclulate size of the object searching
     float wr = bbox.x/2;
     float hr = bbox.y/2;
@@ -409,76 +723,42 @@ std::vector<vec2> EntityGrid::search(vec2 position, vec2 bbox, const std::vector
     auto offsetX = position.x - (size * fx);
     auto offsetY = position.y - (size * fy);
 
-    const float MAX = std::numeric_limits<float>::max();
-
-    // Track which nodes have been closed
-    // bool closed[gridW][gridH];
-    std::vector<std::vector<bool>> closed(gridW);
-
-    // Generate node map with initial values
-    // Node map[gridW][gridH];
-    std::vector<std::vector<Node>> map(gridW);
-    for (int x = 0; x < gridW; x++){
-        closed[x] = std::vector<bool>(gridH);
-        map[x] = std::vector<Node>(gridH);
-        for (int y = 0; y < gridH; y++){
-            map[x][y].position = {x, y};
-            map[x][y].parent = {-1,-1};
-            map[x][y].f = MAX;
-            map[x][y].g = map[x][y].f;
-            map[x][y].h = map[x][y].g;
-            closed[x][y] = false;
-        }
-    }
-
     // If starting position is not valid, or if we're already at the destination, return empty
-    if (!isValid(fx, fy) || isDest(grid, {fx, fy}, dest)) {
+    if (!isValid(fx, fy) || isDest(*this, {fx, fy}, dest)) {
         return std::vector<vec2>();
     }
 
-    // Set starting node
-    int x = fx;
-    int y = fy;
-    map[x][y].f = 0.0;
-    map[x][y].g = 0.0;
-    map[x][y].h = 0.0;
-    map[x][y].parent = {x,y};
-
-    // Add the starting node to the list of open nodes
-    std::vector<Node> open;
-    open.emplace_back(map[x][y]);
-    int debugopencount = 1;
+    // New generation, every node with an older stamp counts as unvisited
+    if (++generation == 0) {
+        for (auto& node : nodes) node.generation = 0;
+        generation = 1;
+    }
+    open.clear();
+
+    // Set starting node, and add it to the list of open nodes
+    int start = fx * gridH + fy;
+    Node& startNode = nodes[start];
+    startNode.generation = generation;
+    startNode.parent = start;
+    startNode.heapIndex = -1;
+    startNode.closed = false;
+    startNode.f = 0.f;
+    startNode.g = 0.f;
+    pushOpen(start);
 
     if (DEBUG_LOG)std::cout << std::endl << "=========================" << std::endl << "startSearch" << std::endl << std::endl;
 
-    int iterN = 0;
-    do {
-        if (DEBUG_LOG)std::cout << std::endl << "ITERATION START: " << iterN << std::endl;
-        if (DEBUG_LOG)std::cout << std::endl << "open (" << open.size() << "):" << debugopencount << std::endl;
-
-        // Get node with lowest f value from open
-        Node node;
-        float tmp = MAX;
-        std::vector<Node>::iterator nodeIt;
-        for (auto it = open.begin(); it != open.end(); it++) {
-            if ((*it).f < tmp) {
-                tmp = (*it).f;
-                nodeIt = it;
-            }
-        }
-        node = (*nodeIt);
-        int curX = node.position.x;
-        int curY = node.position.y;
-
-        if (DEBUG_LOG) {for (auto n : open) printNode(n);}
-        if (DEBUG_LOG)std::cout << std::endl << "getLowest:" << std::endl;
+    while (!open.empty()) {
+        if (DEBUG_LOG)std::cout << std::endl << "open (" << open.size() << ")" << std::endl;
 
-        // Remove the node from open
-        open.erase(nodeIt);
-        debugopencount--;
+        // Take the node with lowest f value from open, and close it
+        int current = popOpen();
+        Node& node = nodes[current];
+        node.closed = true;
+        int curX = current / gridH;
+        int curY = current % gridH;
 
-        // Add to closed
-        closed[node.position.x][node.position.y] = true;
+        if (DEBUG_LOG) printNode(current);
 
         // Check the node's four adjacent squares (W,N,E,S)
         pair adjacent[4] = {{curX-1,curY}, {curX,curY-1}, {curX+1, curY}, {curX, curY+1}};
@@ -487,96 +767,54 @@ std::vector<vec2> EntityGrid::search(vec2 position, vec2 bbox, const std::vector
             int adjY = n.y;
 
             // Ignore if position is invalid
-            if (!isValid(adjX, adjY)) {
-                if (DEBUG_LOG)std::cout << "Node (" << adjX <<","<< adjY << ") not valid, ignoring" << std::endl;
-                continue;
-            }
-
-            // Check for clearance
-            bool clear = true;
-            int clearBoundL = std::max((adjX - (int)std::floor(w/2)), 0);
-            int clearBoundR = std::min((adjX + (int)std::ceil(w/2) + 1), gridW);
-            int clearBoundT = std::max((adjY - (int)std::floor(h/2)), 0);
-            int clearBoundB = std::min((adjY + (int)std::ceil(h/2) + 1), gridH);
-            for (int clearX = clearBoundL; clearX < clearBoundR; clearX++) {
-                for (int clearY = clearBoundT; clearY < clearBoundB; clearY++) {
-                    for (auto type : avoid) {
-                        if (grid[clearX][clearY] == type) {
-                            if (DEBUG_LOG) std::cout << "Node (" << clearX << "," << clearY << ") is avoided type" << std::endl;
-                            clear = false;
-                        }
-                    }
-                }
-            }
-            /*if (!clear){
-                if (DEBUG_LOG) std::cout << "Ignoring" << std::endl;
-                continue;
-            }*/
+            if (!isValid(adjX, adjY)) continue;
+            int index = adjX * gridH + adjY;
+            Node& adj = nodes[index];
 
             // Check for destination
-            if (isDest(grid, {adjX, adjY}, dest)) {
+            if (isDest(*this, {adjX, adjY}, dest)) {
                 if (DEBUG_LOG)std::cout << "Node (" << adjX <<","<< adjY << ") is destination" << std::endl;
-                map[adjX][adjY].parent = node.position;
                 std::vector<vec2> path;
 
-                int px = adjX;
-                int py = adjY;
-
                 // Create path by following nodes' parents back to the start node
-                if (DEBUG_LOG) std::cout << "Generating path: " << std::endl;
-                while (!(map[px][py].parent.x == px && map[px][py].parent.y == py)
-                       && map[px][py].position.x != -1 && map[px][py].position.y != -1) {
-                    vec2 pos = {
+                int p = index;
+                int parent = current;
+                while (p != start) {
+                    path.push_back({
                             // Return path offset to the entity's actual position
-                            (map[px][py].position.x * size + offsetX),
-                            (map[px][py].position.y * size + offsetY),
-                    };
-                    path.emplace_back(pos);
-                    if (DEBUG_LOG)std::cout << "(" << pos.x <<","<< pos.y<<")" << ", ";
-
-                    pair temp = map[px][py].parent;
-                    px = temp.x;
-                    py = temp.y;
+                            ((p / gridH) * size + offsetX),
+                            ((p % gridH) * size + offsetY),
+                    });
+                    p = parent;
+                    parent = nodes[p].parent;
                 }
                 // Note: Ignoring starting node
 
-                if (DEBUG_LOG)std::cout << std::endl << "Successful Search" << std::endl << std::endl<< "=========================" << std::endl;
+                if (DEBUG_LOG)std::cout << "Successful Search" << std::endl << std::endl<< "=========================" << std::endl;
                 return path;
             }
 
-            // Check if not already closed
-            if (!closed[adjX][adjY]){
-                if (DEBUG_LOG)std::cout << "Node (" << adjX <<","<< adjY << ") is not closed, checking path" << std::endl;
-
-                // Calculate new F value
-                float newG = node.g + 1.f; // Since we're only moving in cardinal directions, just increment G
-                if (!clear) newG += 100.f;
-                float newH = hfn(grid, {adjX, adjY}, {dest.x,dest.y});
-                float newF = newG + newH;
-                //if (!clear) newF += 100;
-
-
-                if (DEBUG_LOG)std::cout << "new(f="<<newF<<",g="<<newG<<",h="<<newH<<"), old(f="<<map[adjX][adjY].f<<",g="<<map[adjX][adjY].g<<",h="<<map[adjX][adjY].h<<")"<< std::endl;
-
-                // If it is a new node or has a better f value, update values and add to frontier
-                if (map[adjX][adjY].f == MAX || map[adjX][adjY].f > newF) {
-                    map[adjX][adjY].parent = node.position;
-                    map[adjX][adjY].f = newF;
-                    map[adjX][adjY].g = newG;
-                    map[adjX][adjY].h = newH;
-                    open.emplace_back(map[adjX][adjY]);
-                    debugopencount++;
-                    if (DEBUG_LOG)std::cout << "Added node to open: " << std::endl;
-                    if (DEBUG_LOG) printNode(map[adjX][adjY]);
-                } else {
-                    if (DEBUG_LOG)std::cout << "Path not better" << std::endl;
-                }
-            } else {
-                if (DEBUG_LOG)std::cout << "Node (" << adjX <<","<< adjY << ") is closed" << std::endl;
+            bool seen = adj.generation == generation;
+            if (seen && adj.closed) continue;
+
+            // Calculate new F value
+            float newG = node.g + 1.f; // Since we're only moving in cardinal directions, just increment G
+            if (!isClear(adjX, adjY, w, h, avoid)) newG += 100.f;
+
+            // If it is a new node or has a better path, update values and add to (or move up in) open
+            if (!seen) {
+                adj.generation = generation;
+                adj.heapIndex = -1;
+                adj.closed = false;
+            } else if (adj.g <= newG) {
+                continue;
             }
+            adj.parent = current;
+            adj.g = newG;
+            adj.f = newG + hfn(*this, {adjX, adjY}, dest);
+            pushOpen(index);
         }
-        iterN++;
-    } while (!open.empty());
+    }
 
     if (DEBUG_LOG)std::cout << std::endl<< "Failed Search" << std::endl << std::endl << "=========================" << std::endl;
     // Unable to find path, return empty
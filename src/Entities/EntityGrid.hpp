@@ -7,6 +7,8 @@
 
 
 #include <vector>
+#include <bitset>
+#include <unordered_map>
 #include <Entities/Enemies/Enemy.hpp>
 #include <Entities/Pickups/Pickup.hpp>
 #include "common.hpp"
@@ -22,29 +24,42 @@ enum EType {
     projectile_friendly,
     projectile_hostile,
 };
+const int ETYPE_COUNT = 7;
 
 struct pair {
     int x;
     int y;
 };
 
-// Search nodes
+// Squares [l,r) x [t,b)
+struct GridRect {
+    int l;
+    int t;
+    int r;
+    int b;
+};
+
+// Copy of a grid's occupancy, searched on the pathfinding worker while the grid keeps changing
+struct GridSnapshot {
+    int gridW = 0;
+    int gridH = 0;
+    int size = 0;
+    int planeWords = 0;
+    std::vector<uint64_t> planes;
+    std::vector<int> areaTables;
+};
+
+// Search scratch per grid square, reused across searches.
+// Only valid when generation matches the search's generation, so nothing needs clearing.
 struct Node {
-    pair position;
-    pair parent;
+    unsigned generation;
+    int parent;
+    int heapIndex; // Position in the open heap, -1 when not open
+    bool closed;
     float f;
     float g;
-    float h;
-    bool operator < (const Node& r) const
-    {
-        return f < r.f;
-    }
 };
 
-// Function pointer types for search destination/heuristc
-typedef bool isDestinationFn(const std::vector<std::vector<EType>>& grid, pair pos, pair dest);
-typedef float heuristicFn(const std::vector<std::vector<EType>>& grid, pair pos, pair dest);
-
 // For rendering square colors based on type
 class EntityGridSquare : public EntityOld {
 public:
@@ -63,22 +78,49 @@ public:
     // Cleanup
     void destroy();
 
-    // Set all squares as empty
+    // Set all squares as empty, forgetting every entity
     void clear();
 
-    // Add entities to grid, by calculating which squares they're in and setting them as the appropriate EType
+    // Starts a grid update, entities are then (re)added and endUpdate removes the ones that weren't
+    void beginUpdate();
+    void endUpdate();
+    // Rects whose squares changed since beginUpdate
+    const std::vector<GridRect>& getDirty() const { return dirty; }
+
+    // Whether square x,y holds type
+    bool has(int x, int y, EType type) const;
+    // Type drawn for square x,y when several share it
+    EType typeAt(int x, int y) const;
+    // Squares in rect holding type, from the area tables built by endUpdate
+    int countIn(const GridRect& rect, EType type) const;
+
+    // Add entities to grid, by calculating which squares they're in and setting them as the appropriate EType.
+    // Each entity's last squares are remembered, so re-adding only touches the squares it entered or left.
     void addToGrid(const Player& player);
     void addToGrid(const Vamp& vamp);
     void addToGrid(const Enemy& enemy);
     void addToGrid(const Boss& boss);
     void addToGrid(const Pickup& pickup);
     void addToGrid(const Projectile& projectile);
-    void addBoxToGrid(vec2 tl, vec2 br, EType type);
+    void addBoxToGrid(const void* key, vec2 tl, vec2 br, EType type);
 
     // Draw the grid
     void draw(const mat3 &projection) override;
 
     std::vector<vec2> getPath(const Enemy& enemy, const Player& player);
+    // Path for a bbox sized entity at position to the goal's square
+    std::vector<vec2> getPath(vec2 position, vec2 bbox, vec2 goal, const std::vector<EType>& avoid);
+
+    // Copies the occupancy out, or replaces it with a copy. Searches only need the loaded occupancy, not init.
+    void takeSnapshot(GridSnapshot& out) const;
+    void loadSnapshot(const GridSnapshot& in);
+
+    // Flow field toward target (the player), one reverse Dijkstra over the grid shared by every enemy
+    void updateFlowField(vec2 target, const std::vector<EType>& avoid = {}, vec2 bbox = {0.f, 0.f});
+    // Path from position in the same format as getPath, read from the flow field instead of searching
+    std::vector<vec2> getFlowPath(vec2 position) const;
+    // Unit direction toward the next square on the way to the player, {0,0} if there is none
+    vec2 getFlowDirection(vec2 position) const;
     // Find path for fish to edge of screen
     //std::vector<vec2> getPath(const Fish& fish);
     // Find path for turtle to player
@@ -86,25 +128,70 @@ public:
     // Find path from salmon to fish
     //std::vector<vec2> getPath(const Salmon& salmon, const std::vector<Fish>& fishes);
 private:
-    std::vector<std::vector<EType>> grid;
+    // Entities occupying each square, per EType, indexed by (x*gridH+y)*ETYPE_COUNT + type
+    std::vector<uint16_t> occupancy;
+    // One packed bitplane per EType, bit x*gridH+y set while the square holds the type
+    std::vector<uint64_t> planes;
+    int planeWords = 0;
+    // Summed-area table per EType, rebuilt by endUpdate for types whose plane changed
+    std::vector<int> areaTables;
+    std::bitset<ETYPE_COUNT> planeDirty;
+
+    // Squares an entity was last added to
+    struct Footprint {
+        GridRect rect;
+        EType type;
+        unsigned frame;
+    };
+    std::unordered_map<const void*, Footprint> footprints;
+    unsigned frame = 0;
+    std::vector<GridRect> dirty;
     // How many squares wide
-    int gridW;
+    int gridW = 0;
     // How many squares tall
-    int gridH;
+    int gridH = 0;
     // Side length of squares
-    int size;
+    int size = 0;
 
     // Grid vertices for drawing
     std::vector<Vertex> m_vertices;
     std::vector<uint16_t> m_indices;
     // Draws square colors
     EntityGridSquare square;
+    // A* scratch, gridW*gridH nodes indexed by x*gridH+y
+    std::vector<Node> nodes;
+    unsigned generation = 0;
+    // Open list as a binary min heap of node indices keyed on f
+    std::vector<int> open;
+
+    // Flow field, cost to reach the target and the next square to step to, per square
+    std::vector<float> flowCost;
+    std::vector<int> flowNext;
+    // Flow field frontier as (cost, index) heap
+    std::vector<std::pair<float, int>> flowOpen;
+    int flowTarget = -1;
+
     // Debugging function for printing node information
-    static void printNode(Node node);
+    void printNode(int index) const;
+    // Adds delta to the occupancy of type over the squares of rect, updating their EType
+    void occupy(const GridRect& rect, EType type, int delta);
+    // Occupies the squares of from not in to by delta
+    void occupyDifference(const GridRect& from, const GridRect& to, EType type, int delta);
+    void buildAreaTable(EType type);
     // Check node within grid
-    bool isValid(int x, int y);
-    // A* Search function
-    std::vector<vec2> search(vec2 position, vec2 bbox, std::vector<EType> avoid, isDestinationFn destFn, heuristicFn h,  pair dest={-1,-1}, bool DEBUG_LOG=false);
+    bool isValid(int x, int y) const;
+    // Whether a w by h (squares) window around x,y contains none of the avoided types
+    bool isClear(int x, int y, int w, int h, const std::vector<EType>& avoid) const;
+    // Square index containing position, -1 if outside the grid
+    int squareAt(vec2 position) const;
+    // Open heap operations, push also handles decrease-key for nodes already open
+    void pushOpen(int index);
+    int popOpen();
+    void siftUp(int i);
+    void siftDown(int i);
+    // A* Search function, Destination and Heuristic are policies called as fn(*this, pos, dest)
+    template <typename Destination, typename Heuristic>
+    std::vector<vec2> search(vec2 position, vec2 bbox, const std::vector<EType>& avoid, Destination isDest, Heuristic hfn, pair dest={-1,-1}, bool DEBUG_LOG=false);
 };
 
 
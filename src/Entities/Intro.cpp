@@ -62,11 +62,7 @@ void Intro::draw(const mat3 &projection) {
     auto* motion = getComponent<MotionComponent>();
     auto* sprite = getComponent<SpriteComponent>();
 
-    transform->begin();
-    transform->translate(motion->position);
-    transform->scale({1,1});
-    transform->rotate(0);
-    transform->end();
+    transform->set(motion->position, {1,1}, 0);
 
     sprite->draw(projection, transform->out, effect->program);
 
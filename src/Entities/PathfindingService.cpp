@@ -0,0 +1,122 @@
+//
+// Created on 10/17/2026.
+//
+
+#include <cmath>
+#include "PathfindingService.hpp"
+
+namespace {
+    // Requests in flight each way. Requests that don't fit are dropped, entities ask again on their next refresh.
+    const std::size_t QUEUE_CAPACITY = 1024;
+
+    int square(float v, int size) {
+        return (int)std::floor(v / (float)size);
+    }
+
+    // Whether b can be read from the flow field built for a
+    bool sameField(const PathRequest& a, const PathRequest& b) {
+        int size = a.grid->size;
+        if (a.grid != b.grid || a.avoid != b.avoid) return false;
+        if (square(a.goal.x, size) != square(b.goal.x, size) || square(a.goal.y, size) != square(b.goal.y, size)) return false;
+        // Without anything to avoid the bbox doesn't change the field
+        return a.avoid.empty() || (a.bbox.x == b.bbox.x && a.bbox.y == b.bbox.y);
+    }
+}
+
+PathfindingService::PathfindingService() : requests(QUEUE_CAPACITY), results(QUEUE_CAPACITY) {}
+
+void PathfindingService::start() {
+    if (running.load()) return;
+    running.store(true);
+    worker = std::thread(&PathfindingService::work, this);
+}
+
+void PathfindingService::stop() {
+    if (!running.load()) return;
+    {
+        std::lock_guard<std::mutex> lock(wakeMutex);
+        running.store(false);
+    }
+    wake.notify_one();
+    worker.join();
+    pending.clear();
+
+    // Nothing else touches the queues once the worker is gone
+    PathRequest request;
+    while (requests.pop(request)) {}
+    PathResult result;
+    while (results.pop(result)) {}
+}
+
+void PathfindingService::request(ECS::EntityId entity, vec2 start, vec2 bbox, vec2 goal, const std::vector<EType>& avoid) {
+    pending.push_back({ entity, start, bbox, goal, avoid, nullptr });
+}
+
+void PathfindingService::publish(const EntityGrid& grid) {
+    if (pending.empty()) return;
+
+    std::shared_ptr<GridSnapshot> snapshot(new GridSnapshot());
+    grid.takeSnapshot(*snapshot);
+
+    for (auto& request : pending) {
+        request.grid = snapshot;
+        if (!requests.push(std::move(request))) break;
+    }
+    pending.clear();
+
+    // Taking the lock makes sure the worker either sees the requests or is already waiting
+    { std::lock_guard<std::mutex> lock(wakeMutex); }
+    wake.notify_one();
+}
+
+bool PathfindingService::poll(PathResult& result) {
+    return results.pop(result);
+}
+
+void PathfindingService::work() {
+    while (running.load()) {
+        PathRequest request;
+        while (requests.pop(request)) batch.push_back(std::move(request));
+
+        if (batch.empty()) {
+            std::unique_lock<std::mutex> lock(wakeMutex);
+            wake.wait(lock, [this]() { return !running.load() || !requests.empty(); });
+            continue;
+        }
+
+        solve();
+        batch.clear();
+    }
+    loaded.reset();
+}
+
+void PathfindingService::solve() {
+    const PathRequest* field = nullptr;
+    for (std::size_t i = 0; i < batch.size(); i++) {
+        const PathRequest& request = batch[i];
+        if (request.grid != loaded) {
+            grid.loadSnapshot(*request.grid);
+            loaded = request.grid;
+            field = nullptr;
+        }
+
+        PathResult result;
+        result.entity = request.entity;
+        if (field == nullptr || !sameField(*field, request)) {
+            field = nullptr;
+            // Only worth a whole grid pass if the next request can use it too
+            if (i + 1 < batch.size() && sameField(request, batch[i + 1])) {
+                grid.updateFlowField(request.goal, request.avoid, request.bbox);
+                field = &request;
+            }
+        }
+        result.path = field != nullptr
+                ? grid.getFlowPath(request.start)
+                : grid.getPath(request.start, request.bbox, request.goal, request.avoid);
+
+        while (!results.push(std::move(result))) {
+            if (!running.load()) return;
+            std::this_thread::yield();
+        }
+    }
+}
@@ -0,0 +1,76 @@
+//
+// Created on 10/17/2026.
+//
+
+#ifndef VAPE_PATHFINDINGSERVICE_HPP
+#define VAPE_PATHFINDINGSERVICE_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <Engine/ECS/Entity.hpp>
+#include <Engine/Jobs/SpscQueue.hpp>
+#include "EntityGrid.hpp"
+
+struct PathRequest {
+    ECS::EntityId entity;
+    vec2 start;
+    vec2 bbox;
+    vec2 goal;
+    std::vector<EType> avoid;
+    // Snapshot taken at the end of the frame the request was made in
+    std::shared_ptr<const GridSnapshot> grid;
+};
+
+struct PathResult {
+    ECS::EntityId entity;
+    std::vector<vec2> path;
+};
+
+// Solves path requests on a worker thread against snapshots of the grid.
+// Requests made during a frame are handed over with publish, results come back through poll on a later frame.
+// Requests sharing a goal (and what they avoid) are read from one flow field instead of searched one by one.
+class PathfindingService {
+public:
+    PathfindingService();
+    PathfindingService(const PathfindingService&) = delete;
+    PathfindingService& operator=(const PathfindingService&) = delete;
+    ~PathfindingService() { stop(); }
+
+    void start();
+    // Joins the worker, requests it hasn't solved are dropped
+    void stop();
+
+    // Queues a path request for entity, sent to the worker by the next publish
+    void request(ECS::EntityId entity, vec2 start, vec2 bbox, vec2 goal, const std::vector<EType>& avoid = {});
+    // Snapshots grid and hands it to the worker with the requests made since the last publish.
+    // If the worker falls behind, requests that don't fit in its queue are dropped.
+    void publish(const EntityGrid& grid);
+    // Pops a solved path, false if none are ready
+    bool poll(PathResult& result);
+
+private:
+    // Main thread only
+    std::vector<PathRequest> pending;
+
+    Jobs::SpscQueue<PathRequest> requests;
+    Jobs::SpscQueue<PathResult> results;
+
+    std::thread worker;
+    std::atomic<bool> running{ false };
+    std::mutex wakeMutex;
+    std::condition_variable wake;
+
+    // Worker only, searched after loading a request's snapshot
+    EntityGrid grid;
+    std::shared_ptr<const GridSnapshot> loaded;
+    std::vector<PathRequest> batch;
+
+    void work();
+    void solve();
+};
+
+#endif //VAPE_PATHFINDINGSERVICE_HPP
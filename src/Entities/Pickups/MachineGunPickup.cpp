@@ -11,6 +11,7 @@
 #include <Components/MotionComponent.hpp>
 #include <Components/TransformComponent.hpp>
 #include <Components/EnemyComponent.hpp>
+#include <Components/CollisionComponent.hpp>
 #include <Entities/Weapons/Weapon.hpp>
 #include <Entities/Weapons/WeaponMachineGun.hpp>
 
@@ -23,6 +24,7 @@ bool MachineGunPickup::init(vec2 position) {
 	auto* motion = addComponent<MotionComponent>();
 	auto* transform = addComponent<TransformComponent>();
 	auto* enemy = addComponent<EnemyComponent>();
+	auto* collision = addComponent<CollisionComponent>();
 
 	// Load shared texture
 	if (!pickup_texture.is_valid())
@@ -52,6 +54,8 @@ bool MachineGunPickup::init(vec2 position) {
 	// Setting initial values, scale is negative to make it face the opposite way
 	// 1.0 would be as big as the original texture.
 	physics->scale = { -0.08f, 0.08f };
+	collision->setClass(CollisionClass::Pickup);
+	collision->setRadius(get_bounding_box(), 0.55f * 0.65f);
 
 	return true;
 }
@@ -66,11 +70,7 @@ void MachineGunPickup::draw(const mat3 &projection) {
 	auto* physics = getComponent<PhysicsComponent>();
 	auto* sprite = getComponent<SpriteComponent>();
 
-	transform->begin();
-	transform->translate(motion->position);
-	transform->scale(physics->scale);
-	transform->rotate(motion->radians);
-	transform->end();
+	transform->set(motion->renderPosition, physics->scale, motion->radians);
 
 	sprite->draw(projection, transform->out, effect->program);
 }
@@ -118,11 +118,6 @@ vec2 MachineGunPickup::get_bounding_box() const
 	return { std::fabs(physics->scale.x) * pickup_texture.width, std::fabs(physics->scale.y) * pickup_texture.height };
 }
 
-bool MachineGunPickup::isOffScreen(const vec2& screen) {
-	float h = get_bounding_box().y / 2;
-	return (get_position().y - h > screen.y);
-}
-
 const char* MachineGunPickup::get_png() const {
     return textures_path("pickup.png");
 }
@@ -19,7 +19,6 @@ public:
     virtual bool collides_with(const Player &player) = 0;
     virtual void applyEffect(Player& player) = 0;
 	virtual vec2 get_bounding_box()const { return  { 0.f,0.f }; };
-    virtual bool isOffScreen(const vec2& screen) = 0;
     virtual const char* get_png() const = 0;
     virtual bool isWeapon() = 0;
 };
@@ -19,7 +19,6 @@ public:
     bool collides_with(const Player &player) override;
     void applyEffect(Player& player) override;
 	vec2 get_bounding_box() const override;
-    bool isOffScreen(const vec2 &screen) override;
     const char* get_png() const override;
     bool isWeapon() override;
 private:
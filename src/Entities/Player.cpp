@@ -18,6 +18,7 @@
 #include "Entities/Weapons/WeaponTriShot.hpp"
 #include "Entities/Weapons/WeaponMachineGun.hpp"
 #include <Components/PlayerComponent.hpp>
+#include <Components/CollisionComponent.hpp>
 #include <Systems/ProjectileSystem.hpp>
 
 // Same as static in c, local to compilation unit
@@ -42,6 +43,7 @@ bool Player::init(vec2 screen, int hp)
 	auto* transform = addComponent<TransformComponent>();
 	auto* player = addComponent<PlayerComponent>();
 	auto* health = addComponent<HealthComponent>();
+	auto* collision = addComponent<CollisionComponent>();
 
 	addComponent<BoundaryComponent>(screenBuffer.x, screen.x - screenBuffer.x,
 									screenBuffer.y, screen.y*0.9f - screenBuffer.y);
@@ -72,6 +74,8 @@ bool Player::init(vec2 screen, int hp)
 	motion->maxVelocity = 400.f;
 	motion->friction = 0.1;
 	physics->scale = { -0.30, 0.30 };
+	collision->setClass(CollisionClass::Player);
+	collision->setRadius(get_bounding_box(), 0.6f);
 
 
 	m_light_up_countdown_ms = -1.f;
@@ -160,11 +164,7 @@ void Player::draw(const mat3& projection)
     auto* physics = getComponent<PhysicsComponent>();
     auto* sprite = getComponent<SpriteComponent>();
 
-    transform->begin();
-    transform->translate(motion->position);
-    transform->scale(physics->scale);
-    transform->rotate(motion->radians);
-    transform->end();
+    transform->set(motion->renderPosition, physics->scale, motion->radians);
 
 	float mod = 1;
 	if (m_iframe > 0)
@@ -49,11 +49,7 @@ void LaserBeamSprite::draw(const mat3 &projection, float rotation) {
     auto* sprite = getComponent<SpriteComponent>();
 
     vec2 offset = { m_origin.x  + SPRITE_H/2*sinf(rotation), m_origin.y + SPRITE_H/2*cosf(rotation)};
-    transform->begin();
-    transform->translate(offset);
-    transform->scale({1,1});
-    transform->rotate(-rotation);
-    transform->end();
+    transform->set(offset, {1,1}, -rotation);
 
     sprite->draw(projection, transform->out, effect->program);
 }
@@ -17,6 +17,9 @@ class Boss;
 class Enemy;
 class Clone;
 
+// How far off screen bullets go before they're culled. Enemies fire from above the screen.
+const float PROJECTILE_CULL_MARGIN = 200.f;
+
 class Projectile : public ECS::Entity {
 protected:
     int m_damage = 0;
@@ -25,6 +28,7 @@ protected:
 public:
     virtual bool init(vec2 position, float rotation, bool hostile, int damage) = 0;
     virtual vec2 get_position() const = 0;
+    virtual vec2 get_velocity() const { return {0,0}; }; // px/s
     inline int getDamage() const { return m_damage; };
     inline bool isHostile() const { return m_hostile; };
     inline void setHostile(bool hostile) { m_hostile = hostile; };
@@ -9,6 +9,8 @@
 #include <Components/EffectComponent.hpp>
 #include <Components/TransformComponent.hpp>
 #include <Components/MotionComponent.hpp>
+#include <Components/CollisionComponent.hpp>
+#include <Systems/CullingSystem.hpp>
 #include "bullet.hpp"
 #include "Entities/Player.hpp"
 #include "Entities/Bosses/Boss1.hpp"
@@ -19,13 +21,14 @@ Texture Bullet::bullet_texture;
 float BULLET_SPEED = 1250;
 float BULLET_SPEED_SLOW = 750;
 
-bool Bullet::init(vec2 position, float rotation, bool hostile, int damage) {
+bool Bullet::init() {
     gl_flush_errors();
     auto* sprite = addComponent<SpriteComponent>();
     auto* effect = addComponent<EffectComponent>();
     auto* physics = addComponent<PhysicsComponent>();
     auto* motion = addComponent<MotionComponent>();
     auto* transform = addComponent<TransformComponent>();
+    auto* collision = addComponent<CollisionComponent>();
 
     // Load shared texture
     if (!bullet_texture.is_valid())
@@ -47,19 +50,37 @@ bool Bullet::init(vec2 position, float rotation, bool hostile, int damage) {
     if (gl_has_errors())
         return false;
 
-    m_speed = BULLET_SPEED;
     physics->scale = {0.4f, 0.4f};
+    collision->setRadius(get_bounding_box(), 0.6f);
     motion->velocity = {0.f,0.f};
+    m_speed = BULLET_SPEED;
+    m_velocity = {0.f, 0.f};
+
+    Projectile::m_erase_on_collide = true;
+    return true;
+}
+
+bool Bullet::init(vec2 position, float rotation, bool hostile, int damage) {
+    if (!init())
+        return false;
+    launch(position, rotation, hostile, damage);
+    return true;
+}
+
+void Bullet::launch(vec2 position, float rotation, bool hostile, int damage) {
+    auto* motion = getComponent<MotionComponent>();
+    auto* collision = getComponent<CollisionComponent>();
+    collision->setClass(hostile ? CollisionClass::HostileProjectile : CollisionClass::FriendlyProjectile);
 
     motion->radians = rotation;
     // place bullet n away from center of entity
     motion->position.x = position.x + 100*sin(motion->radians);
     motion->position.y = position.y + 100*cos(motion->radians);
+    m_speed = BULLET_SPEED;
+    update_velocity();
 
     Projectile::m_hostile = hostile;
     Projectile::m_damage = damage;
-    Projectile::m_erase_on_collide = true;
-    return true;
 }
 
 void Bullet::destroy() {
@@ -73,9 +94,8 @@ void Bullet::destroy() {
 
 void Bullet::update(float ms) {
     auto* motion = getComponent<MotionComponent>();
-    float step = m_speed * (ms / 1000);
-    motion->position.x += step*sin(motion->radians);
-    motion->position.y += step*cos(motion->radians);
+    motion->position.x += m_velocity.x * (ms / 1000);
+    motion->position.y += m_velocity.y * (ms / 1000);
 }
 
 void Bullet::draw(const mat3 &projection) {
@@ -86,11 +106,7 @@ void Bullet::draw(const mat3 &projection) {
     auto* physics = getComponent<PhysicsComponent>();
     auto* sprite = getComponent<SpriteComponent>();
 
-    transform->begin();
-    transform->translate(motion->position);
-    transform->scale(physics->scale);
-    transform->rotate(-motion->radians - 3.14f);
-    transform->end();
+    transform->set(motion->renderPosition, physics->scale, -motion->radians - 3.14f);
 
     if (m_hostile) {
         sprite->draw(projection, transform->out, effect->program, {1.0f, 0.5f, 0.5f });
@@ -105,6 +121,11 @@ vec2 Bullet::get_position()const
     return motion->position;
 }
 
+vec2 Bullet::get_velocity()const
+{
+    return m_velocity;
+}
+
 // TODO make a collision component and use a single collides_with over Entity to reduce duplicate code
 bool Bullet::collides_with(const Player &player) {
     auto* motion = getComponent<MotionComponent>();
@@ -166,14 +187,20 @@ vec2 Bullet::get_bounding_box()const
 }
 
 bool Bullet::isOffScreen(const vec2 &screen) {
-    float h = get_bounding_box().y / 2;
-    return (get_position().y - h > screen.y);
+    return CullingSystem::outside(get_position(), get_bounding_box(), PROJECTILE_CULL_MARGIN, screen);
 }
 
 void Bullet::set_speed_fast() {
     m_speed = BULLET_SPEED;
+    update_velocity();
 }
 
 void Bullet::set_speed_slow() {
     m_speed = BULLET_SPEED_SLOW;
+    update_velocity();
+}
+
+void Bullet::update_velocity() {
+    auto* motion = getComponent<MotionComponent>();
+    m_velocity = { m_speed * std::sin(motion->radians), m_speed * std::cos(motion->radians) };
 }
@@ -12,13 +12,18 @@ class Bullet : public Projectile {
     static Texture bullet_texture;
 
 public:
+    // Prefab setup, loads the shaders and sprite that instances share. Fire copies with launch.
+    bool init();
     bool init(vec2 position, float rotation, bool hostile, int damage) override;
+    // Places the bullet and sets who fired it, for a copy of the prefab
+    void launch(vec2 position, float rotation, bool hostile, int damage);
     void destroy() override;
     void update(float ms) override;
     void draw(const mat3& projection) override;
 
     // Returns the current bullet position
     vec2 get_position()const override;
+    vec2 get_velocity()const override;
 
     // Collision routines for player, turtles and fish
     bool collides_with(const Player& player) override;
@@ -36,6 +41,9 @@ public:
 
 private:
     float m_speed;
+    vec2 m_velocity; // Along the bullet's rotation, only changes with its speed
+
+    void update_velocity();
 };
 
 #endif //VAPE_BULLET_HPP
@@ -81,11 +81,7 @@ void BossHealth::draw(const mat3 &projection) {
 
     // Transformation code, see Rendering and Transformation in the template specification for more info
     // Incrementally updates transformation matrix, thus ORDER IS IMPORTANT
-    transform->begin();
-    transform->translate({m_bar->getSize().x*0.005f, m_bar->getSize().y/2});
-    transform->rotate(0);
-    transform->scale({(float)m_health,1});
-    transform->end();
+    transform->set({m_bar->getSize().x*0.005f, m_bar->getSize().y/2}, {(float)m_health,1}, 0);
 
 
     // Setting shaders
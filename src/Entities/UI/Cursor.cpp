@@ -58,11 +58,7 @@ void Cursor::draw(const mat3 &projection) {
     auto* physics = getComponent<PhysicsComponent>();
     auto* sprite = getComponent<SpriteComponent>();
 
-    transform->begin();
-    transform->translate(motion->position);
-    transform->scale(physics->scale);
-    transform->rotate(motion->radians);
-    transform->end();
+    transform->set(motion->position, physics->scale, motion->radians);
 
     sprite->draw(projection, transform->out, effect->program);
 }
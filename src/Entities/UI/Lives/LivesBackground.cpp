@@ -69,11 +69,7 @@ void LivesBackground::draw(const mat3 &projection) {
 
     // Transformation code, see Rendering and Transformation in the template specification for more info
     // Incrementally updates transformation matrix, thus ORDER IS IMPORTANT
-    transform->begin();
-    transform->translate({145, m_screen.y-90});
-    transform->rotate(0);
-    transform->scale({1,1});
-    transform->end();
+    transform->set({145, m_screen.y-90}, {1,1}, 0);
 
     // Setting shaders
     glUseProgram(effect->program);
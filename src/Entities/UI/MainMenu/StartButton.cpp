@@ -63,11 +63,7 @@ void StartButton::draw(const mat3 &projection) {
     auto* physics = getComponent<PhysicsComponent>();
     auto* sprite = getComponent<SpriteComponent>();
 
-    transform->begin();
-    transform->translate(motion->position);
-    transform->scale(physics->scale);
-    transform->rotate(motion->radians);
-    transform->end();
+    transform->set(motion->position, physics->scale, motion->radians);
 
     vec3 color = {1,1,1};
     if (!isSelected())
@@ -61,11 +61,7 @@ void ControlDiagram::draw(const mat3 &projection) {
     auto* motion = getComponent<MotionComponent>();
     auto* physics = getComponent<PhysicsComponent>();
 
-    transform->begin();
-    transform->translate(motion->position);
-    transform->scale(physics->scale);
-    transform->rotate(motion->radians);
-    transform->end();
+    transform->set(motion->position, physics->scale, motion->radians);
 
     sprite->draw(projection, transform->out, effect->program);
 }
@@ -107,11 +107,7 @@ void PauseMenu::draw(const mat3 &projection) {
     auto* effect = getComponent<EffectComponent>();
     auto* sprite = getComponent<SpriteComponent>();
 
-    transform->begin();
-    transform->translate(m_position);
-    transform->scale({1,1});
-    transform->rotate(0);
-    transform->end();
+    transform->set(m_position, {1,1}, 0);
 
     sprite->draw(projection, transform->out, effect->program);
 
@@ -60,11 +60,7 @@ void UIPanel::draw(const mat3 &projection) {
     auto* sprite = getComponent<SpriteComponent>();
 
 
-    transform->begin();
-    transform->translate(motion->position);
-    transform->scale(physics->scale);
-    transform->rotate(motion->radians);
-    transform->end();
+    transform->set(motion->position, physics->scale, motion->radians);
 
 
 
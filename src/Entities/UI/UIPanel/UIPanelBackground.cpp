@@ -67,11 +67,7 @@ void UIPanelBackground::draw(const mat3 &projection) {
 
     // Transformation code, see Rendering and Transformation in the template specification for more info
     // Incrementally updates transformation matrix, thus ORDER IS IMPORTANT
-    transform->begin();
-    transform->translate({0, m_screen.y});
-    transform->rotate(0);
-    transform->scale({1,1});
-    transform->end();
+    transform->set({0, m_screen.y}, {1,1}, 0);
 
     // Setting shaders
     glUseProgram(effect->program);
@@ -32,14 +32,11 @@ void BulletStraightShot::fire(const vec2 &origin_position, float origin_rotation
     auto & projectiles = GameEngine::getInstance().getSystemManager()->getSystem<ProjectileSystem>();
 
     if (m_bullet_cooldown < 0.f) {
-        Bullet* bullet = &GameEngine::getInstance().getEntityManager()->addEntity<Bullet>();
-        if (bullet->init(origin_position, origin_rotation, false, 5)) {
-            m_bullet_cooldown = BULLET_COOLDOWN_MS;
-            Mix_PlayChannel(-1, m_bullet_sound, 0);
-            projectiles.friendly_projectiles.emplace_back(bullet);
-        } else {
-            throw std::runtime_error("Failed to spawn bullet");
-        }
+        Bullet* bullet = &GameEngine::getInstance().getEntityManager()->getCommands().instantiate<Bullet>();
+        bullet->launch(origin_position, origin_rotation, false, 5);
+        m_bullet_cooldown = BULLET_COOLDOWN_MS;
+        Mix_PlayChannel(-1, m_bullet_sound, 0);
+        projectiles.spawn(bullet);
     }
 }
 
@@ -33,32 +33,23 @@ void WeaponTriShot::fire(const vec2 &origin_position, float origin_rotation) {
     if (m_bullet_cooldown < 0.f) {
         amo -= 1;
 
-        Bullet* bullet1 = &GameEngine::getInstance().getEntityManager()->addEntity<Bullet>();
-        if (bullet1->init(origin_position, origin_rotation, false, 5)) {
-            m_bullet_cooldown = BULLET_COOLDOWN_MS;
-            Mix_PlayChannel(-1, m_bullet_sound, 0);
-            projectiles.friendly_projectiles.emplace_back(bullet1);
-        } else {
-            throw std::runtime_error("Failed to spawn bullet");
-        }
+        Bullet* bullet1 = &GameEngine::getInstance().getEntityManager()->getCommands().instantiate<Bullet>();
+        bullet1->launch(origin_position, origin_rotation, false, 5);
+        m_bullet_cooldown = BULLET_COOLDOWN_MS;
+        Mix_PlayChannel(-1, m_bullet_sound, 0);
+        projectiles.spawn(bullet1);
 
-        Bullet* bullet2 = &GameEngine::getInstance().getEntityManager()->addEntity<Bullet>();
-        if (bullet2->init(origin_position, origin_rotation + (M_PI/ 6), false, 5)) {
-            m_bullet_cooldown = BULLET_COOLDOWN_MS;
-            Mix_PlayChannel(-1, m_bullet_sound, 0);
-            projectiles.friendly_projectiles.emplace_back(bullet2);
-        } else {
-            throw std::runtime_error("Failed to spawn bullet");
-        }
+        Bullet* bullet2 = &GameEngine::getInstance().getEntityManager()->getCommands().instantiate<Bullet>();
+        bullet2->launch(origin_position, origin_rotation + (M_PI/ 6), false, 5);
+        m_bullet_cooldown = BULLET_COOLDOWN_MS;
+        Mix_PlayChannel(-1, m_bullet_sound, 0);
+        projectiles.spawn(bullet2);
 
-        Bullet* bullet3 = &GameEngine::getInstance().getEntityManager()->addEntity<Bullet>();
-        if (bullet3->init(origin_position, origin_rotation - (M_PI/ 6), false, 5)) {
-            m_bullet_cooldown = BULLET_COOLDOWN_MS;
-            Mix_PlayChannel(-1, m_bullet_sound, 0);
-            projectiles.friendly_projectiles.emplace_back(bullet3);
-        } else {
-            throw std::runtime_error("Failed to spawn bullet");
-        }
+        Bullet* bullet3 = &GameEngine::getInstance().getEntityManager()->getCommands().instantiate<Bullet>();
+        bullet3->launch(origin_position, origin_rotation - (M_PI/ 6), false, 5);
+        m_bullet_cooldown = BULLET_COOLDOWN_MS;
+        Mix_PlayChannel(-1, m_bullet_sound, 0);
+        projectiles.spawn(bullet3);
     }
 }
 
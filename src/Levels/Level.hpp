@@ -5,7 +5,11 @@
 #ifndef VAPE_LEVEL_HPP
 #define VAPE_LEVEL_HPP
 
+#include <algorithm>
+#include <initializer_list>
 #include <map>
+#include <utility>
+#include <vector>
 #include <Engine/ECS/ECS.hpp>
 #include <Entities/Bosses/Boss.hpp>
 #include <Entities/Enemies/Enemy.hpp>
@@ -18,25 +22,44 @@
 
 namespace Levels {
     typedef Boss* BossSpawner(ECS::EntityManager *e);
-    typedef Enemy* Spawner(ECS::EntityManager *e, vec2 pos, vec2 vel, float dir);
+    // Builds an enemy ahead of its spawn, see EntityManager::prepare
+    typedef ECS::EntityPtr Preparer(ECS::EntityManager *e);
 
     struct spawnStruct {
-        Spawner* fn;
+        Preparer* prepare;
         vec2 pos;
         vec2 vel;
         float dir;
     };
 
     using Wave = std::vector<spawnStruct>;
-    using Timeline = std::map<int, Wave>; // NOTE - YOU CANNOT HAVE WAVES SPAWN AT THE EXACT SAME MS (ITS A MAP)
-
-    template <typename T> Enemy* spawn(ECS::EntityManager *e, vec2 pos, vec2 vel, float dir) {
-        Enemy* t = &e->addEntity<T>();
-        t->init();
-        t->set_position(pos);
-        t->set_velocity(vel);
-        return t;
-        // TODO set direction?
+
+    struct SpawnRecord {
+        int time; // ms into the level
+        spawnStruct spawn;
+    };
+
+    // A level's waves, compiled once into a flat array of spawn records sorted by time.
+    // Several waves can spawn at the same ms, in the order they're listed.
+    class Timeline {
+    private:
+        std::vector<SpawnRecord> records;
+    public:
+        Timeline(std::initializer_list<std::pair<int, Wave>> waves) {
+            for (auto& wave : waves)
+                for (auto& spawn : wave.second)
+                    records.push_back({ wave.first, spawn });
+            std::stable_sort(records.begin(), records.end(), [](const SpawnRecord& a, const SpawnRecord& b) {
+                return a.time < b.time;
+            });
+        }
+
+        std::size_t size() const { return records.size(); }
+        const SpawnRecord& operator[](std::size_t i) const { return records[i]; }
+    };
+
+    template <typename T> ECS::EntityPtr prepare(ECS::EntityManager *e) {
+        return e->prepare<T>();
     }
 
     template <typename T> Boss* spawnBoss(ECS::EntityManager *e) {
@@ -44,9 +67,9 @@ namespace Levels {
         return b;
     }
 
-    inline spawnStruct genSpawn(Spawner fn, vec2 pos, vec2 vel, float dir) {
+    template <typename T> spawnStruct genSpawn(vec2 pos, vec2 vel, float dir) {
         spawnStruct s{};
-        s.fn = fn;
+        s.prepare = prepare<T>;
         s. pos = pos;
         s.dir = dir;
         s.vel = vel;
@@ -55,7 +78,7 @@ namespace Levels {
 
     struct Level {
         unsigned int id;
-        Timeline timeline;
+        const Timeline* timeline; // Levels are copied around, their timeline isn't
         BossSpawner* spawnBoss;
         size_t bossTime;
 
@@ -66,8 +89,8 @@ namespace Levels {
 
         const Level* nextLevel = nullptr;
 
-        Level(unsigned int id, const Timeline t, BossSpawner bs, size_t time, const char* bt, const char* bgm, const char* bm, const char* bd, const Level *next = nullptr) :
-                id(id), timeline(t), spawnBoss(bs), bossTime(time), backgroundTexture(bt), backgroundMusic(bgm), bossMusic(bm), bossDialogue(bd), nextLevel(next)  {}
+        Level(unsigned int id, const Timeline& t, BossSpawner bs, size_t time, const char* bt, const char* bgm, const char* bm, const char* bd, const Level *next = nullptr) :
+                id(id), timeline(&t), spawnBoss(bs), bossTime(time), backgroundTexture(bt), backgroundMusic(bgm), bossMusic(bm), bossDialogue(bd), nextLevel(next)  {}
     };
 
 }
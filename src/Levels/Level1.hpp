@@ -27,12 +27,12 @@ namespace Levels {
             {21000, TMPickupSingle},
 
             {25000, TL3},
-            {25001, TR3},
+            {25000, TR3},
             {25500, TM3},
 
             {30000, TSpaced4},
-            {30001, LSpaced4},
-            {30002, RSpaced4},
+            {30000, LSpaced4},
+            {30000, RSpaced4},
 
             {35000, TSpaced4Fast},
 
@@ -48,59 +48,59 @@ namespace Levels {
             {42000, TSpaced4Fast},
             {42500, TM3},
             {43000, TL3},
-            {43001, TR3},
-            {43002, LSpaced4},
-            {43003, RSpaced4},
+            {43000, TR3},
+            {43000, LSpaced4},
+            {43000, RSpaced4},
 
             {45000, LM3Fast},
             {45500, RM3Fast},
             {46000, TL3Fast},
-            {46001, TR3Fast},
+            {46000, TR3Fast},
             {46500, TSpaced4GenericShooter},
             // {46500, TSpaced4Fast},
             {48000, TRDiag3},
-            {48001, TLDiag3},
+            {48000, TLDiag3},
             {49000, TL3},
-            {49001, TR3},
+            {49000, TR3},
             {49500, LSpaced4},
             {50000, RSpaced4},
 
             {53000, TM3},
             {53500, TL3Fast},
-            {53501, TR3Fast},
+            {53500, TR3Fast},
 
             {55000, LSpaced4},
             {56000, RSpaced4},
 
             {58000, TSpaced4Fast},
             {58100, TSpaced4GenericShooter},
-            {58101, RSpaced4},
-            {58102, TRPickupSingle},
+            {58100, RSpaced4},
+            {58100, TRPickupSingle},
 
 
             {62000, LM3Fast},
             {62500, RM3Fast},
             {63000, TL3Fast},
-            {63001, TR3Fast},
+            {63000, TR3Fast},
 
             {66000, LM2GenericShooter},
             {66500, TSpaced4},
             {67001, TR3Fast},
 
             {69000, LM3},
-            {69001, RM3},
-            {69002, TSpaced4},
+            {69000, RM3},
+            {69000, TSpaced4},
 
             {71000, LM2GenericShooter},
-            {71001, RM2GenericShooter},
+            {71000, RM2GenericShooter},
 
             {74000, TM3},
             {74500, TL3Fast},
-            {74501, TR3Fast},
+            {74500, TR3Fast},
 
             {77000, TSpaced4Fast},
             {77100, TSpaced4GenericShooter},
-            {77101, LSpaced4},
+            {77100, LSpaced4},
             {77200, TLPickupSingle}
     };
 
@@ -28,18 +28,18 @@ namespace Levels {
             {16000, TRTargetSingle},
 
             {18000, LM3Fast},
-            {18001, RM3Fast},
-            {18002, TSpaced4Fast},
+            {18000, RM3Fast},
+            {18000, TSpaced4Fast},
             {19000, TLPickupSingle},
 
             {20000, TSpaced4Fast},
             {20500, TM3},
             {21002, LM2GenericShooter},
-            {21003, RM2GenericShooter},
+            {21002, RM2GenericShooter},
 
             {22500, TSpaced4},
-            {22501, LM2Speedster},
-            {22502, RM2Speedster},
+            {22500, LM2Speedster},
+            {22500, RM2Speedster},
 
             {23500, TLTargetSingle},
             {24000, TRTargetSingle},
@@ -48,35 +48,35 @@ namespace Levels {
             {28000, LM3Fast},
             {28500, RM3Fast},
             {29000, TL3Fast},
-            {29001, TR3Fast},
+            {29000, TR3Fast},
             {29500, TSpaced4Fast},
             {30000, TRPickupSingle},
             {31000, TRDiag3},
-            {31001, TLDiag3},
+            {31000, TLDiag3},
             {32000, TL3},
-            {32001, TR3},
-            {32002, TSpaced4GenericShooter},
+            {32000, TR3},
+            {32000, TSpaced4GenericShooter},
             {32500, LM3Speedster},
             {33000, RM3Speedster},
 
             {35000, LM2GenericShooter},
-            {35001, RM2GenericShooter},
+            {35000, RM2GenericShooter},
 
             {37000, TL3Fast},
             {37100, TR3Fast},
             {38500, TLTargetSingle},
-            {38501, TRTargetSingle},
+            {38500, TRTargetSingle},
 
             {40000, LM3Fast},
             {40500, RM3Fast},
             {41000, TL3Fast},
-            {41001, TR3Fast},
+            {41000, TR3Fast},
             {41500, TSpaced4GenericShooter},
             {43000, TRDiag3},
-            {43001, TLDiag3},
-            {43002, TMPickupSingle},
+            {43000, TLDiag3},
+            {43000, TMPickupSingle},
             {44000, TL3},
-            {44001, TR3},
+            {44000, TR3},
             {44500, LSpaced4},
             {45000, RSpaced4},
 
@@ -87,25 +87,25 @@ namespace Levels {
             {52000, LM3Speedster},
 
             {53000, TLDiag3},
-            {53001, TRDiag3},
+            {53000, TRDiag3},
             {54000, TSpaced4GenericShooter},
 
             {55000, TRDiag3},
-            {55001, TLDiag3},
+            {55000, TLDiag3},
             {56000, TSpaced4Fast},
 
             {57000, TSPaced4Speedster},
             {58000, TRTargetSingle},
             {58500, LM3},
             {59000, TLTargetSingle},
-            {59001, TRPickupSingle},
+            {59000, TRPickupSingle},
             {59500, RM3},
 
             {60000, TSpaced4Fast},
 
             {63000, LM2GenericShooter},
-            {63001, TSpaced4GenericShooter},
-            {63002, TLDiag3},
+            {63000, TSpaced4GenericShooter},
+            {63000, TLDiag3},
 
             {66000, LSpaced4},
             {66500, LM2GenericShooter},
@@ -118,22 +118,22 @@ namespace Levels {
 
             {72500, TSPaced4Speedster},
             {73000, RM3Speedster},
-            {73001, TRPickupSingle},
+            {73000, TRPickupSingle},
             {73500, TSpaced4GenericShooter},
 
             {76000, RM2GenericShooter},
-            {76001, TSpaced4GenericShooter},
-            {76002, TRDiag3},
+            {76000, TSpaced4GenericShooter},
+            {76000, TRDiag3},
 
             {78000, LM3Fast},
             {78500, RM3Fast},
             {79000, TL3Fast},
-            {79001, TR3Fast},
+            {79000, TR3Fast},
             {79500, TSpaced4GenericShooter},
             {81000, TRDiag3},
-            {81001, TLDiag3},
+            {81000, TLDiag3},
             {82000, TL3},
-            {82001, TR3},
+            {82000, TR3},
             {82500, LSpaced4},
             {83000, RSpaced4},
 
@@ -145,38 +145,38 @@ namespace Levels {
             {88000, LM3Fast},
             {88500, RM3Fast},
             {89000, TL3Fast},
-            {89001, TR3Fast},
+            {89000, TR3Fast},
 
 
             {91000, TL3Fast},
-            {91001, TR3Fast},
+            {91000, TR3Fast},
             {91500, TM3Fast},
             {92000, TSpaced4Fast},
             {92500, TL3Fast},
-            {92501, TR3Fast},
+            {92500, TR3Fast},
             {93000, TM3Fast},
             {93500, TSpaced4Fast},
             {95000, TSpaced4GenericShooter},
-            {95001, LM3Speedster},
-            {95002, RM3Speedster},
+            {95000, LM3Speedster},
+            {95000, RM3Speedster},
 
             {97000, TL3Fast},
-            {97001, TR3Fast},
+            {97000, TR3Fast},
             {97500, TM3Fast},
             {98000, TSpaced4Fast},
             {98500, TL3Fast},
-            {98501, TR3Fast},
+            {98500, TR3Fast},
             {99000, TM3Fast},
             {99500, TSpaced4Fast},
             {100000, TLTargetSingle},
-            {100001, TRTargetSingle},
+            {100000, TRTargetSingle},
             {100500, TMTargetSingle},
 
             {102000, TSPaced4Speedster},
             {103000, TLDiag3},
             {103500, LM3},
             {104000, TMTargetSingle},
-            {104001, TLPickupSingle},
+            {104000, TLPickupSingle},
             {104500, RM3},
 
     };
@@ -24,18 +24,18 @@ namespace Levels {
 		{12000, TLExplosiveSingle},
 
 		{14000, TLTargetSingle},
-		{14001, TRTargetSingle},
+		{14000, TRTargetSingle},
 		{15000, TM3},
 
 		{ 18000, LM3Fast},
-		{ 18001, RM3Fast},
-		{ 18002, TSpaced4Fast },
+		{ 18000, RM3Fast},
+		{ 18000, TSpaced4Fast },
 
 		{21000, TExplosiveDouble},
 
 		{22500, TMTargetSingle},
 		{23500, LM3},
-		{23501, RM3},
+		{23500, RM3},
 		{24000, TLPickupSingle},
 
 		{25000, TL3Fast},
@@ -45,7 +45,7 @@ namespace Levels {
 		{27500, TRTargetSingle},
 
 		{28000, TLDiag3},
-		{28001, TRDiag3},
+		{28000, TRDiag3},
 
 		{30000, LM2GenericShooter},
 		{32000, RM2GenericShooter},
@@ -61,7 +61,7 @@ namespace Levels {
 
 		{40000, TMTargetSingle},
 		{41000, TLDiag3},
-		{41001, TRDiag3},
+		{41000, TRDiag3},
 		{42000, TSpaced4},
 
 		{43000, TRPickupSingle},
@@ -69,9 +69,9 @@ namespace Levels {
 		{44000, TSpaced4Fast},
 		{44500, TM3},
 		{45000, TL3},
-		{45001, TR3},
-		{45002, LSpaced4},
-		{45003, RSpaced4}
+		{45000, TR3},
+		{45000, LSpaced4},
+		{45000, RSpaced4}
     };
 
     const Level level3 = Level(
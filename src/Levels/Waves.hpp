@@ -35,119 +35,119 @@ namespace Levels {
      * Turtle-only Waves
      *
      */
-    const Wave TL3 = {genSpawn(spawn < Turtle > , {100, -100}, TD, 0.f),
-                      genSpawn(spawn < Turtle > , {200, -150}, TD, 0.f),
-                      genSpawn(spawn < Turtle > , {300, -100}, TD, 0.f)
+    const Wave TL3 = {genSpawn<Turtle>({100, -100}, TD, 0.f),
+                      genSpawn<Turtle>({200, -150}, TD, 0.f),
+                      genSpawn<Turtle>({300, -100}, TD, 0.f)
     };
 
-    const Wave TL3Fast = {genSpawn(spawn < Turtle > , {100, -100}, TD2, 0.f),
-                          genSpawn(spawn < Turtle > , {200, -150}, TD2, 0.f),
-                          genSpawn(spawn < Turtle > , {300, -100}, TD2, 0.f)
+    const Wave TL3Fast = {genSpawn<Turtle>({100, -100}, TD2, 0.f),
+                          genSpawn<Turtle>({200, -150}, TD2, 0.f),
+                          genSpawn<Turtle>({300, -100}, TD2, 0.f)
     };
 
-    const Wave TM3 = {genSpawn(spawn < Turtle > , {300, -100}, TD, 0.f),
-                      genSpawn(spawn < Turtle > , {400, -150}, TD, 0.f),
-                      genSpawn(spawn < Turtle > , {500, -100}, TD, 0.f)
+    const Wave TM3 = {genSpawn<Turtle>({300, -100}, TD, 0.f),
+                      genSpawn<Turtle>({400, -150}, TD, 0.f),
+                      genSpawn<Turtle>({500, -100}, TD, 0.f)
     };
-    const Wave TM3Fast = {genSpawn(spawn < Turtle > , {300, -100}, TD2, 0.f),
-                      genSpawn(spawn < Turtle > , {400, -150}, TD2, 0.f),
-                      genSpawn(spawn < Turtle > , {500, -100}, TD2, 0.f)
+    const Wave TM3Fast = {genSpawn<Turtle>({300, -100}, TD2, 0.f),
+                      genSpawn<Turtle>({400, -150}, TD2, 0.f),
+                      genSpawn<Turtle>({500, -100}, TD2, 0.f)
     };
 
-    const Wave TR3 = {genSpawn(spawn < Turtle > , {500, -100}, TD, 0.f),
-                      genSpawn(spawn < Turtle > , {600, -150}, TD, 0.f),
-                      genSpawn(spawn < Turtle > , {700, -100}, TD, 0.f)
+    const Wave TR3 = {genSpawn<Turtle>({500, -100}, TD, 0.f),
+                      genSpawn<Turtle>({600, -150}, TD, 0.f),
+                      genSpawn<Turtle>({700, -100}, TD, 0.f)
     };
-    const Wave TR3Fast = {genSpawn(spawn < Turtle > , {500, -100}, TD2, 0.f),
-                          genSpawn(spawn < Turtle > , {600, -150}, TD2, 0.f),
-                          genSpawn(spawn < Turtle > , {700, -100}, TD2, 0.f)
+    const Wave TR3Fast = {genSpawn<Turtle>({500, -100}, TD2, 0.f),
+                          genSpawn<Turtle>({600, -150}, TD2, 0.f),
+                          genSpawn<Turtle>({700, -100}, TD2, 0.f)
     };
 
     const Wave TSpaced4 = {
-            genSpawn(spawn < Turtle > , {150, -100}, TD, 0.f),
-            genSpawn(spawn < Turtle > , {300, -100}, TD, 0.f),
-            genSpawn(spawn < Turtle > , {450, -100}, TD, 0.f),
-            genSpawn(spawn < Turtle > , {600, -100}, TD, 0.f),
+            genSpawn<Turtle>({150, -100}, TD, 0.f),
+            genSpawn<Turtle>({300, -100}, TD, 0.f),
+            genSpawn<Turtle>({450, -100}, TD, 0.f),
+            genSpawn<Turtle>({600, -100}, TD, 0.f),
     };
 
     const Wave TSpaced4Fast = {
-            genSpawn(spawn < Turtle > , {150, -100}, TD2, 0.f),
-            genSpawn(spawn < Turtle > , {300, -100}, TD2, 0.f),
-            genSpawn(spawn < Turtle > , {450, -100}, TD2, 0.f),
-            genSpawn(spawn < Turtle > , {600, -100}, TD2, 0.f),
+            genSpawn<Turtle>({150, -100}, TD2, 0.f),
+            genSpawn<Turtle>({300, -100}, TD2, 0.f),
+            genSpawn<Turtle>({450, -100}, TD2, 0.f),
+            genSpawn<Turtle>({600, -100}, TD2, 0.f),
     };
 
 
     const Wave TSpaced3 = {
-            genSpawn(spawn < Turtle > , {250, -100}, TD, 0.f),
-            genSpawn(spawn < Turtle > , {400, -100}, TD, 0.f),
-            genSpawn(spawn < Turtle > , {550, -100}, TD, 0.f),
+            genSpawn<Turtle>({250, -100}, TD, 0.f),
+            genSpawn<Turtle>({400, -100}, TD, 0.f),
+            genSpawn<Turtle>({550, -100}, TD, 0.f),
     };
 
 
-    const Wave LM3 = {genSpawn(spawn < Turtle > , {-100, 200}, TR, 0.f),
-                      genSpawn(spawn < Turtle > , {-150, 400}, TR, 0.f),
-                      genSpawn(spawn < Turtle > , {-200, 600}, TR, 0.f)
+    const Wave LM3 = {genSpawn<Turtle>({-100, 200}, TR, 0.f),
+                      genSpawn<Turtle>({-150, 400}, TR, 0.f),
+                      genSpawn<Turtle>({-200, 600}, TR, 0.f)
     };
 
-    const Wave LM3Low = {genSpawn(spawn < Turtle > , {-100, 300}, TR, 0.f),
-                      genSpawn(spawn < Turtle > , {-150, 500}, TR, 0.f),
-                      genSpawn(spawn < Turtle > , {-200, 700}, TR, 0.f)
+    const Wave LM3Low = {genSpawn<Turtle>({-100, 300}, TR, 0.f),
+                      genSpawn<Turtle>({-150, 500}, TR, 0.f),
+                      genSpawn<Turtle>({-200, 700}, TR, 0.f)
     };
 
-    const Wave LM3Fast = {genSpawn(spawn < Turtle > , {-100, 200}, TR2, 0.f),
-                          genSpawn(spawn < Turtle > , {-150, 400}, TR2, 0.f),
-                          genSpawn(spawn < Turtle > , {-200, 600}, TR2, 0.f)
+    const Wave LM3Fast = {genSpawn<Turtle>({-100, 200}, TR2, 0.f),
+                          genSpawn<Turtle>({-150, 400}, TR2, 0.f),
+                          genSpawn<Turtle>({-200, 600}, TR2, 0.f)
     };
-    const Wave LM3FastLow = {genSpawn(spawn < Turtle > , {-100, 300}, TR2, 0.f),
-                          genSpawn(spawn < Turtle > , {-150, 500}, TR2, 0.f),
-                          genSpawn(spawn < Turtle > , {-200, 700}, TR2, 0.f)
+    const Wave LM3FastLow = {genSpawn<Turtle>({-100, 300}, TR2, 0.f),
+                          genSpawn<Turtle>({-150, 500}, TR2, 0.f),
+                          genSpawn<Turtle>({-200, 700}, TR2, 0.f)
     };
 
-    const Wave LSpaced4 = {genSpawn(spawn < Turtle > , {-100, 150}, TR, 0.f),
-                           genSpawn(spawn < Turtle > , {-100, 350}, TR, 0.f),
-                           genSpawn(spawn < Turtle > , {-100, 550}, TR, 0.f),
-                           genSpawn(spawn < Turtle > , {-100, 750}, TR, 0.f)
+    const Wave LSpaced4 = {genSpawn<Turtle>({-100, 150}, TR, 0.f),
+                           genSpawn<Turtle>({-100, 350}, TR, 0.f),
+                           genSpawn<Turtle>({-100, 550}, TR, 0.f),
+                           genSpawn<Turtle>({-100, 750}, TR, 0.f)
     };
 
     const Wave LSpaced3 = {
-            genSpawn(spawn < Turtle > , {-100, 200}, TR, 0.f),
-            genSpawn(spawn < Turtle > , {-100, 500}, TR, 0.f),
-            genSpawn(spawn < Turtle > , {-100, 800}, TR, 0.f),
+            genSpawn<Turtle>({-100, 200}, TR, 0.f),
+            genSpawn<Turtle>({-100, 500}, TR, 0.f),
+            genSpawn<Turtle>({-100, 800}, TR, 0.f),
     };
 
     const Wave TLDiag3 = {
-            genSpawn(spawn < Turtle > , {0, -100}, TDR, 0.f),
-            genSpawn(spawn < Turtle > , {-100, -100}, TDR, 0.f),
-            genSpawn(spawn < Turtle > , {-200, -0}, TDR, 0.f)
+            genSpawn<Turtle>({0, -100}, TDR, 0.f),
+            genSpawn<Turtle>({-100, -100}, TDR, 0.f),
+            genSpawn<Turtle>({-200, -0}, TDR, 0.f)
     };
 
-    const Wave RM3 = {genSpawn(spawn < Turtle > , {SW + 100, 300}, TL, 0.f),
-                      genSpawn(spawn < Turtle > , {SW + 150, 500}, TL, 0.f),
-                      genSpawn(spawn < Turtle > , {SW + 300, 700}, TL, 0.f)
+    const Wave RM3 = {genSpawn<Turtle>({SW + 100, 300}, TL, 0.f),
+                      genSpawn<Turtle>({SW + 150, 500}, TL, 0.f),
+                      genSpawn<Turtle>({SW + 300, 700}, TL, 0.f)
     };
 
-    const Wave RM3Fast = {genSpawn(spawn < Turtle > , {SW + 100, 300}, TL2, 0.f),
-                          genSpawn(spawn < Turtle > , {SW + 150, 500}, TL2, 0.f),
-                          genSpawn(spawn < Turtle > , {SW + 300, 700}, TL2, 0.f)
+    const Wave RM3Fast = {genSpawn<Turtle>({SW + 100, 300}, TL2, 0.f),
+                          genSpawn<Turtle>({SW + 150, 500}, TL2, 0.f),
+                          genSpawn<Turtle>({SW + 300, 700}, TL2, 0.f)
     };
 
-    const Wave RSpaced4 = {genSpawn(spawn < Turtle > , {SW + 100, 250}, TL, 0.f),
-                           genSpawn(spawn < Turtle > , {SW + 100, 450}, TL, 0.f),
-                           genSpawn(spawn < Turtle > , {SW + 100, 650}, TL, 0.f),
-                           genSpawn(spawn < Turtle > , {SW + 100, 850}, TL, 0.f)
+    const Wave RSpaced4 = {genSpawn<Turtle>({SW + 100, 250}, TL, 0.f),
+                           genSpawn<Turtle>({SW + 100, 450}, TL, 0.f),
+                           genSpawn<Turtle>({SW + 100, 650}, TL, 0.f),
+                           genSpawn<Turtle>({SW + 100, 850}, TL, 0.f)
     };
 
     const Wave RSpaced3 = {
-            genSpawn(spawn < Turtle > , {SW + 100, 200}, TL, 0.f),
-            genSpawn(spawn < Turtle > , {SW + 100, 500}, TL, 0.f),
-            genSpawn(spawn < Turtle > , {SW + 100, 800}, TL, 0.f),
+            genSpawn<Turtle>({SW + 100, 200}, TL, 0.f),
+            genSpawn<Turtle>({SW + 100, 500}, TL, 0.f),
+            genSpawn<Turtle>({SW + 100, 800}, TL, 0.f),
     };
 
     const Wave TRDiag3 = {
-            genSpawn(spawn < Turtle > , {SW + 0, -100}, TDL, 0.f),
-            genSpawn(spawn < Turtle > , {SW + 100, -100}, TDL, 0.f),
-            genSpawn(spawn < Turtle > , {SW + 200, -0}, TDL, 0.f)
+            genSpawn<Turtle>({SW + 0, -100}, TDL, 0.f),
+            genSpawn<Turtle>({SW + 100, -100}, TDL, 0.f),
+            genSpawn<Turtle>({SW + 200, -0}, TDL, 0.f)
     };
 
 
@@ -161,30 +161,30 @@ namespace Levels {
      */
 
 	const Wave TSpaced2GenericShooter = {
-			genSpawn(spawn < EnemyGenericShooter > , {SW/2 + 200, -100}, TD, 0.f),
-			genSpawn(spawn < EnemyGenericShooter > , {SW/2 - 200, -100}, TD, 0.f),
+			genSpawn<EnemyGenericShooter>({SW/2 + 200, -100}, TD, 0.f),
+			genSpawn<EnemyGenericShooter>({SW/2 - 200, -100}, TD, 0.f),
 	};
 
 	const Wave TSpaced3GenericShooter = {
-			genSpawn(spawn < EnemyGenericShooter > , {250, -100}, TD, 0.f),
-			genSpawn(spawn < EnemyGenericShooter > , {400, -200}, TD, 0.f),
-			genSpawn(spawn < EnemyGenericShooter > , {550, -100}, TD, 0.f),
+			genSpawn<EnemyGenericShooter>({250, -100}, TD, 0.f),
+			genSpawn<EnemyGenericShooter>({400, -200}, TD, 0.f),
+			genSpawn<EnemyGenericShooter>({550, -100}, TD, 0.f),
 	};
 
     const Wave TSpaced4GenericShooter = {
-            genSpawn(spawn < EnemyGenericShooter > , {150, -100}, TD, 0.f),
-            genSpawn(spawn < EnemyGenericShooter > , {300, -100}, TD, 0.f),
-            genSpawn(spawn < EnemyGenericShooter > , {450, -100}, TD, 0.f),
-            genSpawn(spawn < EnemyGenericShooter > , {600, -100}, TD, 0.f),
+            genSpawn<EnemyGenericShooter>({150, -100}, TD, 0.f),
+            genSpawn<EnemyGenericShooter>({300, -100}, TD, 0.f),
+            genSpawn<EnemyGenericShooter>({450, -100}, TD, 0.f),
+            genSpawn<EnemyGenericShooter>({600, -100}, TD, 0.f),
     };
 
 
 
-    const Wave LM2GenericShooter = {genSpawn(spawn < EnemyGenericShooter > , {-100, 200}, TR, 0.f),
-                                    genSpawn(spawn < EnemyGenericShooter > , {-150, 400}, TR, 0.f),
+    const Wave LM2GenericShooter = {genSpawn<EnemyGenericShooter>({-100, 200}, TR, 0.f),
+                                    genSpawn<EnemyGenericShooter>({-150, 400}, TR, 0.f),
     };
-    const Wave RM2GenericShooter = {genSpawn(spawn < EnemyGenericShooter > , {SW + 100, 300}, TL, 0.f),
-                                    genSpawn(spawn < EnemyGenericShooter > , {SW + 150, 500}, TL, 0.f),
+    const Wave RM2GenericShooter = {genSpawn<EnemyGenericShooter>({SW + 100, 300}, TL, 0.f),
+                                    genSpawn<EnemyGenericShooter>({SW + 150, 500}, TL, 0.f),
     };
 
 
@@ -197,9 +197,9 @@ namespace Levels {
      *
      */
 
-    const Wave TLTargetSingle = {genSpawn(spawn < EnemyTargettedShooter > , {100, -100}, TD, 0.f)};
-    const Wave TRTargetSingle = {genSpawn(spawn <EnemyTargettedShooter>, {SW-100, -100}, TD, 0.f)};
-    const Wave TMTargetSingle = {genSpawn(spawn <EnemyTargettedShooter>, {SW/2, -100}, TD, 0.f)};
+    const Wave TLTargetSingle = {genSpawn<EnemyTargettedShooter>({100, -100}, TD, 0.f)};
+    const Wave TRTargetSingle = {genSpawn<EnemyTargettedShooter>({SW-100, -100}, TD, 0.f)};
+    const Wave TMTargetSingle = {genSpawn<EnemyTargettedShooter>({SW/2, -100}, TD, 0.f)};
 
     /*
      *
@@ -208,42 +208,42 @@ namespace Levels {
      */
 	// Note: Explosive payload homes in on player, thus setting a velocity is not necessary
 
-    const Wave TLExplosiveSingle = { genSpawn(spawn < EnemyExplosivePlayload > , {100, -100}, TD, 0.f)};
-	const Wave TRExplosiveSingle = { genSpawn(spawn < EnemyExplosivePlayload > , {SW - 100, -100}, TD, 0.f) };
-	const Wave TMExplosiveSingle = { genSpawn(spawn < EnemyExplosivePlayload > , {SW/2, -100}, TD, 0.f) };
-	const Wave TExplosiveDouble = { genSpawn(spawn < EnemyExplosivePlayload > , {200, -100}, TD, 0.f),
-									genSpawn(spawn < EnemyExplosivePlayload > , {SW - 200, -100}, TD, 0.f) };
-	const Wave TExplosiveTriple = { genSpawn(spawn < EnemyExplosivePlayload > , {200, -100}, TD, 0.f),
-									genSpawn(spawn < EnemyExplosivePlayload > , {SW/2, -200}, TD, 0.f),
-									genSpawn(spawn < EnemyExplosivePlayload > , {SW - 200, -100}, TD, 0.f) };
+    const Wave TLExplosiveSingle = { genSpawn<EnemyExplosivePlayload>({100, -100}, TD, 0.f)};
+	const Wave TRExplosiveSingle = { genSpawn<EnemyExplosivePlayload>({SW - 100, -100}, TD, 0.f) };
+	const Wave TMExplosiveSingle = { genSpawn<EnemyExplosivePlayload>({SW/2, -100}, TD, 0.f) };
+	const Wave TExplosiveDouble = { genSpawn<EnemyExplosivePlayload>({200, -100}, TD, 0.f),
+									genSpawn<EnemyExplosivePlayload>({SW - 200, -100}, TD, 0.f) };
+	const Wave TExplosiveTriple = { genSpawn<EnemyExplosivePlayload>({200, -100}, TD, 0.f),
+									genSpawn<EnemyExplosivePlayload>({SW/2, -200}, TD, 0.f),
+									genSpawn<EnemyExplosivePlayload>({SW - 200, -100}, TD, 0.f) };
 
     /*
      *
      * Speedster Waves
      *
      */
-    const Wave TMSpeedsterSingle = {genSpawn(spawn <EnemySpeedster>, {SW/2, -100}, TD, 0.f)};
+    const Wave TMSpeedsterSingle = {genSpawn<EnemySpeedster>({SW/2, -100}, TD, 0.f)};
 
     const Wave TSPaced4Speedster = {
-            genSpawn(spawn < EnemySpeedster > , {150, -100}, TD, 0.f),
-            genSpawn(spawn < EnemySpeedster > , {300, -100}, TD, 0.f),
-            genSpawn(spawn < EnemySpeedster > , {450, -100}, TD, 0.f),
-            genSpawn(spawn < EnemySpeedster > , {600, -100}, TD, 0.f),
+            genSpawn<EnemySpeedster>({150, -100}, TD, 0.f),
+            genSpawn<EnemySpeedster>({300, -100}, TD, 0.f),
+            genSpawn<EnemySpeedster>({450, -100}, TD, 0.f),
+            genSpawn<EnemySpeedster>({600, -100}, TD, 0.f),
     };
 
-    const Wave LM2Speedster = {genSpawn(spawn < EnemySpeedster > , {-100, 200}, TR, 0.f),
-                              genSpawn(spawn < EnemySpeedster > , {-150, 400}, TR, 0.f),};
+    const Wave LM2Speedster = {genSpawn<EnemySpeedster>({-100, 200}, TR, 0.f),
+                              genSpawn<EnemySpeedster>({-150, 400}, TR, 0.f),};
 
-    const Wave LM3Speedster = {genSpawn(spawn < EnemySpeedster > , {-100, 200}, TR, 0.f),
-                               genSpawn(spawn < EnemySpeedster > , {-150, 400}, TR, 0.f),
-                               genSpawn(spawn < EnemySpeedster > , {-200, 600}, TR, 0.f),};
+    const Wave LM3Speedster = {genSpawn<EnemySpeedster>({-100, 200}, TR, 0.f),
+                               genSpawn<EnemySpeedster>({-150, 400}, TR, 0.f),
+                               genSpawn<EnemySpeedster>({-200, 600}, TR, 0.f),};
 
-    const Wave RM2Speedster = {genSpawn(spawn < EnemySpeedster > , {-100, 300}, TR, 0.f),
-                                genSpawn(spawn < EnemySpeedster > , {SW + 150, 500}, TL, 0.f),};
+    const Wave RM2Speedster = {genSpawn<EnemySpeedster>({-100, 300}, TR, 0.f),
+                                genSpawn<EnemySpeedster>({SW + 150, 500}, TL, 0.f),};
 
-    const Wave RM3Speedster = {genSpawn(spawn < EnemySpeedster > , {-100, 300}, TR, 0.f),
-                               genSpawn(spawn < EnemySpeedster > , {SW + 150, 500}, TL, 0.f),
-                               genSpawn(spawn < EnemySpeedster > , {SW + 200, 700}, TL, 0.f),};
+    const Wave RM3Speedster = {genSpawn<EnemySpeedster>({-100, 300}, TR, 0.f),
+                               genSpawn<EnemySpeedster>({SW + 150, 500}, TL, 0.f),
+                               genSpawn<EnemySpeedster>({SW + 200, 700}, TL, 0.f),};
 
 	/*
 	 *
@@ -251,9 +251,9 @@ namespace Levels {
 	 *
 	 */
 
-	const Wave TLPickupSingle = { genSpawn(spawn <PickupEnemy>, {100, -100}, TD, 0.f) };
-    const Wave TRPickupSingle = { genSpawn(spawn <PickupEnemy>, {SW-100, -100}, TD, 0.f) };
-    const Wave TMPickupSingle = { genSpawn(spawn <PickupEnemy>, {SW/2, -100}, TD, 0.f) };
+	const Wave TLPickupSingle = { genSpawn<PickupEnemy>({100, -100}, TD, 0.f) };
+    const Wave TRPickupSingle = { genSpawn<PickupEnemy>({SW-100, -100}, TD, 0.f) };
+    const Wave TMPickupSingle = { genSpawn<PickupEnemy>({SW/2, -100}, TD, 0.f) };
 
 }
 #endif //VAPE_WAVES_HPP
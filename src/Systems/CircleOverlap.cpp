@@ -0,0 +1,134 @@
+//
+// Created on 10/17/2026.
+//
+
+#include <algorithm>
+#include "CircleOverlap.hpp"
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define VAPE_X86
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+#endif
+
+// MSVC compiles intrinsics for any instruction set, GCC and Clang need the function to opt in
+#if defined(VAPE_X86) && (defined(__GNUC__) || defined(__clang__))
+#define VAPE_TARGET(isa) __attribute__((target(isa)))
+#else
+#define VAPE_TARGET(isa)
+#endif
+
+namespace CircleOverlap {
+    namespace {
+        bool overlaps(float x, float y, float r, float cx, float cy, float cr) {
+            float dx = x - cx;
+            float dy = y - cy;
+            float d = std::max(r, cr);
+            return dx * dx + dy * dy < d * d;
+        }
+
+        // Fills masks from circle begin, which must be a multiple of 8
+        void scalarTail(float x, float y, float r, const float* xs, const float* ys, const float* rs,
+                        std::size_t begin, std::size_t count, std::uint8_t* masks) {
+            for (std::size_t i = begin; i < count; i += 8) {
+                std::uint8_t mask = 0;
+                for (std::size_t j = i; j < i + 8 && j < count; ++j) {
+                    if (overlaps(x, y, r, xs[j], ys[j], rs[j]))
+                        mask |= (std::uint8_t)(1u << (j - i));
+                }
+                masks[i / 8] = mask;
+            }
+        }
+
+#ifdef VAPE_X86
+        VAPE_TARGET("sse2")
+        int sse4(__m128 x, __m128 y, __m128 r, const float* xs, const float* ys, const float* rs) {
+            __m128 dx = _mm_sub_ps(x, _mm_loadu_ps(xs));
+            __m128 dy = _mm_sub_ps(y, _mm_loadu_ps(ys));
+            __m128 d = _mm_max_ps(r, _mm_loadu_ps(rs));
+            __m128 distance = _mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy));
+            return _mm_movemask_ps(_mm_cmplt_ps(distance, _mm_mul_ps(d, d)));
+        }
+
+        VAPE_TARGET("sse2")
+        void sse(float x, float y, float r, const float* xs, const float* ys, const float* rs, std::size_t count,
+                 std::uint8_t* masks) {
+            __m128 vx = _mm_set1_ps(x);
+            __m128 vy = _mm_set1_ps(y);
+            __m128 vr = _mm_set1_ps(r);
+            std::size_t i = 0;
+            for (; i + 8 <= count; i += 8) {
+                int low = sse4(vx, vy, vr, xs + i, ys + i, rs + i);
+                int high = sse4(vx, vy, vr, xs + i + 4, ys + i + 4, rs + i + 4);
+                masks[i / 8] = (std::uint8_t)(low | (high << 4));
+            }
+            scalarTail(x, y, r, xs, ys, rs, i, count, masks);
+        }
+
+        VAPE_TARGET("avx2")
+        void avx2(float x, float y, float r, const float* xs, const float* ys, const float* rs, std::size_t count,
+                  std::uint8_t* masks) {
+            __m256 vx = _mm256_set1_ps(x);
+            __m256 vy = _mm256_set1_ps(y);
+            __m256 vr = _mm256_set1_ps(r);
+            std::size_t i = 0;
+            for (; i + 8 <= count; i += 8) {
+                __m256 dx = _mm256_sub_ps(vx, _mm256_loadu_ps(xs + i));
+                __m256 dy = _mm256_sub_ps(vy, _mm256_loadu_ps(ys + i));
+                __m256 d = _mm256_max_ps(vr, _mm256_loadu_ps(rs + i));
+                __m256 distance = _mm256_add_ps(_mm256_mul_ps(dx, dx), _mm256_mul_ps(dy, dy));
+                masks[i / 8] = (std::uint8_t)_mm256_movemask_ps(_mm256_cmp_ps(distance, _mm256_mul_ps(d, d), _CMP_LT_OQ));
+            }
+            scalarTail(x, y, r, xs, ys, rs, i, count, masks);
+        }
+
+        bool hasSse2() {
+#if defined(__x86_64__) || defined(_M_X64)
+            return true; // Part of x86-64
+#elif defined(_MSC_VER)
+            int info[4];
+            __cpuid(info, 1);
+            return (info[3] & (1 << 26)) != 0;
+#else
+            return __builtin_cpu_supports("sse2");
+#endif
+        }
+
+        bool hasAvx2() {
+#ifdef _MSC_VER
+            int info[4];
+            __cpuid(info, 0);
+            if (info[0] < 7)
+                return false;
+            __cpuid(info, 1);
+            bool osxsave = (info[2] & (1 << 27)) != 0;
+            bool avx = (info[2] & (1 << 28)) != 0;
+            // The OS must also save the YMM registers on context switches
+            if (!osxsave || !avx || (_xgetbv(0) & 0x6) != 0x6)
+                return false;
+            __cpuidex(info, 7, 0);
+            return (info[1] & (1 << 5)) != 0;
+#else
+            return __builtin_cpu_supports("avx2");
+#endif
+        }
+#endif
+    }
+
+    void scalar(float x, float y, float r, const float* xs, const float* ys, const float* rs, std::size_t count,
+                std::uint8_t* masks) {
+        scalarTail(x, y, r, xs, ys, rs, 0, count, masks);
+    }
+
+    Kernel select() {
+#ifdef VAPE_X86
+        if (hasAvx2())
+            return avx2;
+        if (hasSse2())
+            return sse;
+#endif
+        return scalar;
+    }
+}
@@ -0,0 +1,34 @@
+//
+// Created on 10/17/2026.
+//
+
+#ifndef VAPE_CIRCLEOVERLAP_HPP
+#define VAPE_CIRCLEOVERLAP_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+// Tests one circle against a structure of arrays of circles, several at a time.
+// Circles overlap when either center is inside the other circle, i.e. when the distance between
+// the centers is less than the larger of the two radii, matching radius CollisionComponents.
+namespace CircleOverlap {
+    // Sets bit (i % 8) of masks[i / 8] for every circle i (xs[i], ys[i], rs[i]) the circle (x, y, r) overlaps.
+    // masks must hold (count + 7) / 8 bytes, every one of which is written.
+    using Kernel = void (*)(float x, float y, float r,
+                            const float* xs, const float* ys, const float* rs, std::size_t count,
+                            std::uint8_t* masks);
+
+    void scalar(float x, float y, float r, const float* xs, const float* ys, const float* rs, std::size_t count,
+                std::uint8_t* masks);
+
+    // The best kernel the CPU supports: AVX2 (8 circles at a time), SSE (4 at a time), or scalar
+    Kernel select();
+
+    inline void test(float x, float y, float r, const float* xs, const float* ys, const float* rs, std::size_t count,
+                     std::uint8_t* masks) {
+        static const Kernel kernel = select();
+        kernel(x, y, r, xs, ys, rs, count, masks);
+    }
+}
+
+#endif //VAPE_CIRCLEOVERLAP_HPP
@@ -0,0 +1,67 @@
+//
+// Created on 10/17/2026.
+//
+
+#ifndef VAPE_COLLISIONEVENTS_HPP
+#define VAPE_COLLISIONEVENTS_HPP
+
+#include <array>
+#include <cstddef>
+#include <vector>
+#include <Engine/ECS/Entity.hpp>
+#include <Components/CollisionComponent.hpp>
+
+// A collision between entity a, of the buffer's first class, and entity b, of its second.
+// Handles may be stale by the time the event is handled, check them with EntityManager::isValid.
+struct CollisionEvent {
+    ECS::EntityId a;
+    ECS::EntityId b;
+};
+
+// Collision events written during detection, one contiguous buffer per (class, class) pair,
+// consumed in bulk by the systems responding to them. Cleared at the start of every detection pass.
+class CollisionEvents {
+private:
+    static constexpr std::size_t classCount = (std::size_t)CollisionClass::Count;
+
+    std::array<std::vector<CollisionEvent>, classCount * classCount> buffers;
+
+    static std::size_t index(CollisionClass a, CollisionClass b) {
+        return (std::size_t)a * classCount + (std::size_t)b;
+    }
+
+public:
+    // Records the pair in both orders, so get works with either class first
+    void push(CollisionClass aClass, ECS::EntityId a, CollisionClass bClass, ECS::EntityId b) {
+        buffers[index(aClass, bClass)].push_back({ a, b });
+        if (aClass != bClass)
+            buffers[index(bClass, aClass)].push_back({ b, a });
+    }
+
+    // Events where a is of class aClass and b of class bClass
+    const std::vector<CollisionEvent>& get(CollisionClass aClass, CollisionClass bClass) const {
+        return buffers[index(aClass, bClass)];
+    }
+
+    // Appends another set of events, e.g. from a detection job
+    void append(const CollisionEvents& other) {
+        for (std::size_t i = 0; i < buffers.size(); ++i)
+            buffers[i].insert(buffers[i].end(), other.buffers[i].begin(), other.buffers[i].end());
+    }
+
+    // Keeps the buffers' capacity, so steady state detection doesn't allocate
+    void clear() {
+        for (auto& buffer : buffers)
+            buffer.clear();
+    }
+
+    bool empty() const {
+        for (auto& buffer : buffers) {
+            if (!buffer.empty())
+                return false;
+        }
+        return true;
+    }
+};
+
+#endif //VAPE_COLLISIONEVENTS_HPP
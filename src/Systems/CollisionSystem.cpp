@@ -2,39 +2,185 @@
 // Created by Cody on 11/6/2019.
 //
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
 #include <Engine/GameEngine.hpp>
-#include <Components/CollisionComponent.hpp>
+#include <Components/MotionComponent.hpp>
+#include "CircleOverlap.hpp"
 #include "CollisionSystem.hpp"
 
-// WIP
+namespace {
+    std::uint64_t cellKey(std::int32_t x, std::int32_t y) {
+        return ((std::uint64_t)(std::uint32_t)x << 32) | (std::uint32_t)y;
+    }
 
-void CollisionSystem::update(float ms) {
-    for (auto & e1 : *GameEngine::getInstance().getEntityManager()->getEntities()) {
-        if (!e1.second->hasComponent<CollisionComponent>())
-            continue;
-        for (auto & e2 : *GameEngine::getInstance().getEntityManager()->getEntities()) {
-            if (!e2.second->hasComponent<CollisionComponent>())
-                continue;
-            if (e1.first == e2.first)
-                continue;
+    // Half extents of the box containing everything the collider can touch
+    vec2 halfExtents(const CollisionComponent& c) {
+        if (c.type == collidableType::radius) {
+            float r = std::max(c.radius, std::max(c.size.x, c.size.y) * 0.5f);
+            return { r, r };
+        }
+        return { c.size.x * 0.5f, c.size.y * 0.5f };
+    }
 
-            if (checkCollision(e1.second, e2.second)) {
-                auto * e1col = e1.second->getComponent<CollisionComponent>();
-                auto * e2col = e2.second->getComponent<CollisionComponent>();
-                e1.second->collideWith(e1col->classname, *e2.second);
-                e2.second->collideWith(e2col->classname, *e1.second);
+    // Whether the segment from + t * delta, t in [0, 1], passes through the box of the given half extents
+    // centered on the origin
+    bool segmentBox(vec2 from, vec2 delta, vec2 half) {
+        float enter = 0.f;
+        float exit = 1.f;
+        const float start[] = { from.x, from.y };
+        const float direction[] = { delta.x, delta.y };
+        const float extent[] = { half.x, half.y };
+        for (int axis = 0; axis < 2; ++axis) {
+            if (direction[axis] == 0.f) {
+                if (std::fabs(start[axis]) >= extent[axis])
+                    return false;
+                continue;
             }
+            float t1 = (-extent[axis] - start[axis]) / direction[axis];
+            float t2 = (extent[axis] - start[axis]) / direction[axis];
+            enter = std::max(enter, std::min(t1, t2));
+            exit = std::min(exit, std::max(t1, t2));
+            if (enter >= exit)
+                return false;
         }
+        return true;
+    }
+
+    // Whether the centers, from + t * delta apart, get closer than the larger radius
+    bool sweptCircles(vec2 from, vec2 delta, float r1, float r2) {
+        float lengthSq = delta.x * delta.x + delta.y * delta.y;
+        float t = 0.f;
+        if (lengthSq > 0.f)
+            t = std::max(0.f, std::min(1.f, -(from.x * delta.x + from.y * delta.y) / lengthSq));
+        float dx = from.x + delta.x * t;
+        float dy = from.y + delta.y * t;
+        float r = std::max(r1, r2);
+        return dx * dx + dy * dy < r * r;
     }
 }
 
-bool CollisionSystem::checkCollision(std::unique_ptr<ECS::Entity>& e1,std::unique_ptr<ECS::Entity>& e2) {
-    auto * e1col = e1->getComponent<CollisionComponent>();
-    auto * e2col = e2->getComponent<CollisionComponent>();
+CollisionSystem::CollisionSystem(float cellSize) : cellSize(cellSize) {}
+
+bool CollisionSystem::overlaps(const CollisionComponent& c1, vec2 from1, vec2 to1, const ECS::Entity& e1,
+                               const CollisionComponent& c2, vec2 from2, vec2 to2, const ECS::Entity& e2) {
+    if (c1.type == collidableType::complex)
+        return c1.test != nullptr && c1.test(e1, to2, c2.size);
+    if (c2.type == collidableType::complex)
+        return c2.test != nullptr && c2.test(e2, to1, c1.size);
 
-    // TODO check for a collision depending on collisionComponent type and other components?
-    // Pull bounding box from sprite component?
+    // Collider 1's path relative to collider 2
+    vec2 from = { from1.x - from2.x, from1.y - from2.y };
+    vec2 delta = { (to1.x - from1.x) - (to2.x - from2.x), (to1.y - from1.y) - (to2.y - from2.y) };
+
+    if (c1.type == collidableType::radius && c2.type == collidableType::radius)
+        return sweptCircles(from, delta, c1.radius, c2.radius);
+    if (c1.type == collidableType::aabb && c2.type == collidableType::aabb)
+        return segmentBox(from, delta, { (c1.size.x + c2.size.x) * 0.5f, (c1.size.y + c2.size.y) * 0.5f });
+    // The box grown by the radius, a little generous at the corners
+    if (c1.type == collidableType::radius && c2.type == collidableType::aabb)
+        return segmentBox(from, delta, { c2.size.x * 0.5f + c1.radius, c2.size.y * 0.5f + c1.radius });
+    if (c1.type == collidableType::aabb && c2.type == collidableType::radius)
+        return segmentBox(from, delta, { c1.size.x * 0.5f + c2.radius, c1.size.y * 0.5f + c2.radius });
     return false;
 }
 
+// Snapshots every active collider and the grid cells covered by its bounds along its path since the last update
+void CollisionSystem::gather() {
+    colliders.clear();
+    cells.clear();
+
+    auto& entities = GameEngine::getInstance().getEntityManager()->query<CollisionComponent, MotionComponent>();
+    for (auto* e : entities) {
+        auto* collision = e->getComponent<CollisionComponent>();
+        vec2 position = e->getComponent<MotionComponent>()->position;
+        vec2 previous = collision->tested ? collision->lastPosition : position;
+        collision->lastPosition = position;
+        collision->tested = true;
+        if (!e->isActive() || collision->type == collidableType::none || collision->mask == 0)
+            continue;
+
+        vec2 half = halfExtents(*collision);
+        Collider collider = {
+                e, collision, previous, position,
+                (std::int32_t)std::floor((std::min(previous.x, position.x) - half.x) / cellSize),
+                (std::int32_t)std::floor((std::min(previous.y, position.y) - half.y) / cellSize),
+                (std::int32_t)std::floor((std::max(previous.x, position.x) + half.x) / cellSize),
+                (std::int32_t)std::floor((std::max(previous.y, position.y) + half.y) / cellSize)
+        };
+
+        auto index = (std::uint32_t)colliders.size();
+        colliders.push_back(collider);
+        for (std::int32_t y = collider.minY; y <= collider.maxY; ++y)
+            for (std::int32_t x = collider.minX; x <= collider.maxX; ++x)
+                cells.push_back({ cellKey(x, y), index });
+    }
+
+    std::sort(cells.begin(), cells.end());
+
+    // Circles are placed at the middle of their path, their radius grown by half the path's length plus the
+    // most any other circle in the cell moved, so the circle test can't miss a swept hit
+    xs.resize(cells.size());
+    ys.resize(cells.size());
+    rs.resize(cells.size());
+    std::size_t begin = 0;
+    while (begin < cells.size()) {
+        std::size_t end = begin;
+        float slack = 0.f;
+        for (; end < cells.size() && cells[end].cell == cells[begin].cell; ++end) {
+            const Collider& collider = colliders[cells[end].collider];
+            float dx = collider.position.x - collider.previous.x;
+            float dy = collider.position.y - collider.previous.y;
+            xs[end] = (collider.previous.x + collider.position.x) * 0.5f;
+            ys[end] = (collider.previous.y + collider.position.y) * 0.5f;
+            rs[end] = std::sqrt(dx * dx + dy * dy) * 0.5f;
+            slack = std::max(slack, rs[end]);
+        }
+        for (std::size_t i = begin; i < end; ++i) {
+            const CollisionComponent& collision = *colliders[cells[i].collider].collision;
+            rs[i] = collision.type == collidableType::radius ? collision.radius + rs[i] + slack
+                                                             : std::numeric_limits<float>::infinity();
+        }
+        begin = end;
+    }
+}
+
+void CollisionSystem::testPair(const Collider& a, const Collider& b) {
+    if (!(a.collision->mask & b.collision->layer) || !(b.collision->mask & a.collision->layer))
+        return;
+
+    if (overlaps(*a.collision, a.previous, a.position, *a.entity, *b.collision, b.previous, b.position, *b.entity))
+        events.push(a.collision->collisionClass, a.entity->getId(), b.collision->collisionClass, b.entity->getId());
+}
 
+void CollisionSystem::update(float ms) {
+    events.clear();
+    gather();
+
+    // Each run of entries with the same key is one cell
+    std::size_t begin = 0;
+    while (begin < cells.size()) {
+        std::size_t end = begin + 1;
+        while (end < cells.size() && cells[end].cell == cells[begin].cell)
+            ++end;
+
+        for (std::size_t i = begin; i + 1 < end; ++i) {
+            const Collider& a = colliders[cells[i].collider];
+            std::size_t count = end - i - 1;
+            masks.resize((count + 7) / 8);
+            CircleOverlap::test(xs[i], ys[i], rs[i], &xs[i + 1], &ys[i + 1], &rs[i + 1], count, masks.data());
+
+            for (std::size_t k = 0; k < count; ++k) {
+                if (!(masks[k / 8] & (1u << (k % 8))))
+                    continue;
+                const Collider& b = colliders[cells[i + 1 + k].collider];
+                // Pairs sharing several cells are only tested in the first one they share
+                std::uint64_t first = cellKey(std::max(a.minX, b.minX), std::max(a.minY, b.minY));
+                if (first == cells[begin].cell)
+                    testPair(a, b);
+            }
+        }
+        begin = end;
+    }
+}
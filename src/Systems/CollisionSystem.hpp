@@ -6,16 +6,62 @@
 #define VAPE_COLLISIONSYSTEM_HPP
 
 
+#include <cstdint>
+#include <vector>
 #include <Engine/ECS/System.hpp>
+#include <Components/CollisionComponent.hpp>
+#include "CollisionEvents.hpp"
 
+// Detects collisions between entities with a CollisionComponent and a MotionComponent, writing them to typed
+// event buffers instead of calling back into entity code. Response systems read the events after it runs.
+//
+// Broadphase: colliders are bucketed into a uniform grid, hashed by cell so it's unbounded, and only pairs
+// sharing a cell whose layers and masks match are handed to the narrowphase. Circles are filtered against
+// the rest of their cell several at a time with CircleOverlap.
+//
+// Circles and boxes are swept from where they were at the last update to where they are now, so fast
+// projectiles can't step over what they hit at low tick rates. Complex colliders are tested where they are.
 class CollisionSystem : public ECS::System {
 private:
+    struct Collider {
+        ECS::Entity* entity;
+        const CollisionComponent* collision;
+        vec2 previous; // Position at the last update
+        vec2 position;
+        std::int32_t minX, minY, maxX, maxY; // Cells covered by the bounds, over the whole path
+    };
+
+    struct CellEntry {
+        std::uint64_t cell;
+        std::uint32_t collider;
+        bool operator<(const CellEntry& other) const {
+            return cell < other.cell || (cell == other.cell && collider < other.collider);
+        }
+    };
+
+    float cellSize;
+    CollisionEvents events;
+    // Rebuilt every update, kept around so steady state detection doesn't allocate
+    std::vector<Collider> colliders;
+    std::vector<CellEntry> cells;
+    // Bounding circle of each cell entry's collider path, in cell order, for the SIMD circle test.
+    // Non radius colliders get an infinite radius so they always pass it.
+    std::vector<float> xs, ys, rs;
+    std::vector<std::uint8_t> masks;
+
+    void gather();
+    void testPair(const Collider& a, const Collider& b);
 
 public:
+    explicit CollisionSystem(float cellSize = 128.f);
+
     void update(float ms) override;
 
-private:
-    bool checkCollision(std::unique_ptr<ECS::Entity>& e1, std::unique_ptr<ECS::Entity>& e2);
+    const CollisionEvents& getEvents() const { return events; }
+
+    // Narrowphase, whether the colliders touch anywhere along their paths, moving from "from" to "to"
+    static bool overlaps(const CollisionComponent& c1, vec2 from1, vec2 to1, const ECS::Entity& e1,
+                         const CollisionComponent& c2, vec2 from2, vec2 to2, const ECS::Entity& e2);
 };
 
 
@@ -0,0 +1,43 @@
+//
+// Created on 10/17/2026.
+//
+
+#include <Engine/GameEngine.hpp>
+#include <Components/MotionComponent.hpp>
+#include <Components/CullBoundsComponent.hpp>
+#include <Components/LifetimeComponent.hpp>
+#include "CullingSystem.hpp"
+
+bool CullingSystem::outside(vec2 position, vec2 size, float margin, vec2 screen) {
+    float w = size.x / 2;
+    float h = size.y / 2;
+    return position.x + w < -margin || position.x - w > screen.x + margin ||
+           position.y + h < -margin || position.y - h > screen.y + margin;
+}
+
+void CullingSystem::update(float ms) {
+    int w, h;
+    glfwGetFramebufferSize(GameEngine::getInstance().getM_window(), &w, &h);
+    screen = { (float)w / GameEngine::getInstance().getM_screen_scale(), (float)h / GameEngine::getInstance().getM_screen_scale() };
+
+    auto* entityManager = GameEngine::getInstance().getEntityManager();
+    culled.clear();
+
+    entityManager->view<LifetimeComponent>().each([this, ms](ECS::Entity& e, LifetimeComponent& lifetime) {
+        lifetime.remaining -= ms;
+        if (lifetime.remaining <= 0.f && e.isActive())
+            culled.push_back(&e);
+    });
+
+    entityManager->view<MotionComponent, CullBoundsComponent>().each(
+            [this](ECS::Entity& e, MotionComponent& motion, CullBoundsComponent& cull) {
+        if (e.isActive() && outside(motion.position, cull.size, cull.margin, screen))
+            culled.push_back(&e);
+    });
+
+    // Destroyed after the passes, destroy() may spawn entities. An entity can be culled by both.
+    for (auto* e : culled) {
+        if (e->isActive())
+            e->destroy();
+    }
+}
@@ -0,0 +1,33 @@
+//
+// Created on 10/17/2026.
+//
+
+#ifndef VAPE_CULLINGSYSTEM_HPP
+#define VAPE_CULLINGSYSTEM_HPP
+
+#include <vector>
+#include <common.hpp>
+#include <Engine/ECS/System.hpp>
+
+// Destroys entities whose LifetimeComponent ran out, or that left the screen as described by their
+// CullBoundsComponent, with one pass over each component's storage.
+// Culled entities are only marked destroyed, so anything listing them has to drop them before the next entity
+// manager update. The systems owning such lists add the components to what they own, and run after this one.
+// It doesn't declare its access: destroying releases GL resources, so it stays exclusive on the main thread,
+// which also keeps those systems ordered after it.
+class CullingSystem : public ECS::System {
+private:
+    vec2 screen = { 0.f, 0.f };
+    std::vector<ECS::Entity*> culled; // Kept around so steady state culling doesn't allocate
+public:
+    void update(float ms) override;
+
+    // Screen size at the last update, scaled like entity positions
+    vec2 getScreen() const { return screen; }
+
+    // Whether the box of the given size centered on position is entirely outside the screen grown by margin
+    static bool outside(vec2 position, vec2 size, float margin, vec2 screen);
+};
+
+
+#endif //VAPE_CULLINGSYSTEM_HPP
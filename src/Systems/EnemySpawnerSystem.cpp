@@ -2,20 +2,36 @@
 // Created by Cody on 10/17/2019.
 //
 
+#include <algorithm>
 #include <Engine/GameEngine.hpp>
 #include <iostream>
+#include <Components/CullBoundsComponent.hpp>
 #include "EnemySpawnerSystem.hpp"
 
+namespace {
+    // Enemies fly in from well off screen
+    const float ENEMY_CULL_MARGIN = 400.f;
+}
+
+EnemySpawnerSystem::EnemySpawnerSystem() : prepared(level->size()) {}
+
 void EnemySpawnerSystem::update(float ms) {
+    // Drops the enemies CullingSystem destroyed
+    auto destroyed = [](const Enemy* e) { return !e->isActive(); };
+    enemies.erase(std::remove_if(enemies.begin(), enemies.end(), destroyed), enemies.end());
+
     time += ms;
-    auto it = level.begin();
-    while (it != level.end()) {
-        if (it->first <= time) {
-            spawnWave(it->second);
-            it = level.erase(it);
-        } else {
-            it++;
-        }
+    while (cursor < level->size() && (*level)[cursor].time <= time) {
+        prepare(cursor);
+        spawn((*level)[cursor].spawn, std::move(prepared[cursor]));
+        ++cursor;
+    }
+
+    prepareCursor = std::max(prepareCursor, cursor);
+    for (std::size_t i = 0; i < preparePerUpdate && prepareCursor < level->size(); ++i) {
+        if ((*level)[prepareCursor].time > time + prepareWindow)
+            break;
+        prepare(prepareCursor++);
     }
 }
 
@@ -23,19 +39,58 @@ std::vector<Enemy*> *EnemySpawnerSystem::getEnemies() {
     return &enemies;
 }
 
-void EnemySpawnerSystem::reset(Levels::Timeline& levelTimeline) {
-    level = levelTimeline;
-    time = 0;
+void EnemySpawnerSystem::reset(const Levels::Timeline& levelTimeline) {
+    level = &levelTimeline;
+    cursor = 0;
+    prepareCursor = 0;
+    time = 0.f;
     for (auto& enemy : enemies) {
         enemy->destroy();
     }
     enemies.clear();
+    // Room for every enemy of the level, so spawning during it doesn't allocate
+    enemies.reserve(level->size());
+
+    prepared.clear();
+    prepared.resize(level->size());
+    // Builds the first enemy of each type now, initializing its prefab while a hitch doesn't matter
+    std::vector<Levels::Preparer*> types;
+    for (std::size_t i = 0; i < level->size(); ++i) {
+        auto* preparer = (*level)[i].spawn.prepare;
+        if (std::find(types.begin(), types.end(), preparer) == types.end()) {
+            types.push_back(preparer);
+            prepare(i);
+        }
+    }
+}
+
+void EnemySpawnerSystem::setPrepareWindow(int ms, std::size_t perUpdate) {
+    prepareWindow = ms;
+    preparePerUpdate = perUpdate;
+}
+
+void EnemySpawnerSystem::prepare(std::size_t record) {
+    if (!prepared[record])
+        prepared[record] = build((*level)[record].spawn);
+}
+
+ECS::EntityPtr EnemySpawnerSystem::build(const Levels::spawnStruct& spawn) {
+    ECS::EntityPtr entity = spawn.prepare(GameEngine::getInstance().getEntityManager());
+    auto* enemy = static_cast<Enemy*>(entity.get());
+    enemy->addComponent<CullBoundsComponent>(enemy->get_bounding_box(), ENEMY_CULL_MARGIN);
+    return entity;
 }
 
 void EnemySpawnerSystem::spawnWave(const Levels::Wave& wave) {
-    for (auto &wavit : wave) {
-        // std::cout << "spawned" << std::endl;
-        Enemy* t = wavit.fn(GameEngine::getInstance().getEntityManager(), wavit.pos, wavit.vel, wavit.dir);
-        enemies.emplace_back(t);
-    }
+    for (auto &wavit : wave)
+        spawn(wavit, build(wavit));
+}
+
+void EnemySpawnerSystem::spawn(const Levels::spawnStruct& spawn, ECS::EntityPtr entity) {
+    // std::cout << "spawned" << std::endl;
+    auto* t = static_cast<Enemy*>(&GameEngine::getInstance().getEntityManager()->addPrepared(std::move(entity)));
+    t->set_position(spawn.pos);
+    t->set_velocity(spawn.vel);
+    // TODO set direction?
+    enemies.emplace_back(t);
 }
@@ -10,16 +10,34 @@
 #include <Entities/Enemies/turtle.hpp>
 #include <Levels/Levels.hpp>
 
+// Replays a level's timeline, spawning every record whose time has come and moving a cursor past it.
+// Enemies are built (copied from their prefab) a window ahead of their spawn time, a few per update, so
+// spawning one only adds it to the entity manager. Each enemy type's prefab is initialized on reset.
+// Enemies are culled by CullingSystem, which has to run first.
 class EnemySpawnerSystem : public ECS::System {
 private:
-    int time = 0;
+    float time = 0.f; // ms into the level, fractional like the fixed step so it keeps pace with LevelState's clock
     std::vector<Enemy*> enemies;
-    Levels::Timeline level = Levels::level1Timeline;
+    const Levels::Timeline* level = &Levels::level1Timeline;
+    std::size_t cursor = 0; // Next record of level to spawn
+    std::size_t prepareCursor = 0; // Next record of level to build ahead
+    std::vector<ECS::EntityPtr> prepared; // Indexed like level's records, enemies built but not spawned yet
+    int prepareWindow = 500; // ms
+    std::size_t preparePerUpdate = 4;
+
+    void prepare(std::size_t record);
+    ECS::EntityPtr build(const Levels::spawnStruct& spawn);
+    void spawn(const Levels::spawnStruct& spawn, ECS::EntityPtr entity);
 public:
+    EnemySpawnerSystem();
+
     void update(float ms) override;
     std::vector<Enemy*> *getEnemies();
-    void reset(Levels::Timeline& levelTimeline);
+    void reset(const Levels::Timeline& levelTimeline);
     void spawnWave(const Levels::Wave& wave);
+
+    // How far ahead enemies are built, and how many at most per update. A window of 0 builds them as they spawn.
+    void setPrepareWindow(int ms, std::size_t perUpdate);
 };
 
 
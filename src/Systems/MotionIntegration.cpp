@@ -0,0 +1,60 @@
+//
+// Created on 10/17/2026.
+//
+// MotionSystem's integration. It doesn't depend on the engine, so the motion benchmark can link it on its own.
+//
+
+#include <algorithm>
+#include <Components/MotionComponent.hpp>
+#include <Components/BoundaryComponent.hpp>
+#include "MotionSystem.hpp"
+#include "Engine/ECS/ECS.hpp"
+
+namespace {
+    // Only the speed cap branches, friction is v -= friction * v either way
+    inline float accelerate(float v, float a, float max) {
+        return std::max(std::min(v + a, max), -max);
+    }
+
+    inline void integrate(MotionComponent& motion, float seconds) {
+        float vx = motion.velocity.x;
+        float vy = motion.velocity.y;
+        float max = motion.maxVelocity;
+        if (max >= 0) {
+            vx = accelerate(vx, motion.acceleration.x, max);
+            vy = accelerate(vy, motion.acceleration.y, max);
+        }
+
+        motion.position.x += vx * seconds;
+        motion.position.y += vy * seconds;
+
+        // Velocity decay from friction
+        motion.velocity.x = vx - motion.friction * vx;
+        motion.velocity.y = vy - motion.friction * vy;
+    }
+
+    inline void integrate(MotionComponent& motion, const BoundaryComponent& boundary, float seconds) {
+        integrate(motion, seconds);
+        motion.position.x = std::min(std::max(motion.position.x, boundary.minX), boundary.maxX);
+        motion.position.y = std::min(std::max(motion.position.y, boundary.minY), boundary.maxY);
+    }
+}
+
+void MotionSystem::step(ECS::EntityManager& entities, float ms) {
+    float seconds = ms / 1000;
+
+    // Unbounded movement
+    entities.view<MotionComponent>(ECS::componentMask<BoundaryComponent>()).eachChunk(
+        [&](std::size_t count, MotionComponent* motions) {
+            // TODO maybe add some way to avoid being affected by slowdown, or a separate component for vamp mode slowdown
+            for (std::size_t i = 0; i < count; ++i)
+                integrate(motions[i], seconds);
+        });
+
+    // Handle Boundaries
+    entities.view<MotionComponent, BoundaryComponent>().eachChunk(
+        [&](std::size_t count, MotionComponent* motions, BoundaryComponent* boundaries) {
+            for (std::size_t i = 0; i < count; ++i)
+                integrate(motions[i], boundaries[i], seconds);
+        });
+}
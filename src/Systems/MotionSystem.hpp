@@ -7,12 +7,18 @@
 
 
 #include <Engine/ECS/System.hpp>
+#include <Engine/ECS/EntityManager.hpp>
 #include <Components/MotionComponent.hpp>
+#include <Components/BoundaryComponent.hpp>
 
 class MotionSystem : public ECS::System {
-private:
-    void accelerate(MotionComponent* motion);
 public:
+    // Moves every entity of entities that has a MotionComponent over ms, a chunk at a time straight in component
+    // storage. Accelerates, clamped to maxVelocity when it's not negative, moves by velocity, clamps to the
+    // BoundaryComponent if there is one, then applies friction.
+    static void step(ECS::EntityManager& entities, float ms);
+
+    MotionSystem();
     void update(float ms) override;
 };
 
@@ -2,33 +2,36 @@
 // Created by Andy on 12/03/2019.
 //
 
+#include <algorithm>
 #include <Engine/GameEngine.hpp>
+#include <Components/CullBoundsComponent.hpp>
 #include <Components/PlayerComponent.hpp>
 #include <Components/HealthComponent.hpp>
 #include <Components/EnemyComponent.hpp>
 #include <Entities/Pickups/Pickup.hpp>
 #include "PickupSystem.hpp"
 
+namespace {
+    // Pickups drop from enemies that can be just above the screen
+    const float PICKUP_CULL_MARGIN = 100.f;
+}
+
+PickupSystem::PickupSystem() {
+    // Pickups' own updates don't touch any components, they're moved by MotionSystem
+    reading<>();
+}
+
 void PickupSystem::update(float ms) {
+    // Drop the pickups CullingSystem destroyed, then update the rest
+    auto destroyed = [](const Pickup* p) { return !p->isActive(); };
+    pickups.erase(std::remove_if(pickups.begin(), pickups.end(), destroyed), pickups.end());
+    for (auto* pickup : pickups)
+        pickup->update(ms);
+}
 
-    // Get screen size
-    int w, h;
-    glfwGetFramebufferSize(GameEngine::getInstance().getM_window(), &w, &h);
-    vec2 screen = { (float)w / GameEngine::getInstance().getM_screen_scale(), (float)h / GameEngine::getInstance().getM_screen_scale() };
-
-    // Update bullets, removing out of screen bullets
-    auto pickup_it = pickups.begin();
-    while(pickup_it != pickups.end()) {
-        if ((*pickup_it)->isOffScreen(screen))
-        {
-            (*pickup_it)->destroy();
-			pickup_it = pickups.erase(pickup_it);
-            continue;
-        } else {
-            (*pickup_it)->update(ms);
-        }
-        ++pickup_it;
-    }
+void PickupSystem::add(Pickup* pickup) {
+    pickup->addComponent<CullBoundsComponent>(pickup->get_bounding_box(), PICKUP_CULL_MARGIN);
+    pickups.push_back(pickup);
 }
 
 std::vector<Pickup*>* PickupSystem::getPickups() {
@@ -40,4 +43,5 @@ void PickupSystem::clear() {
     for (auto* pickup : pickups) {
         pickup->destroy();
     }
+    pickups.clear();
 }
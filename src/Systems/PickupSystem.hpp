@@ -11,10 +11,14 @@
 
 class Pickup;
 
+// Pickups are culled by CullingSystem, which has to run first
 class PickupSystem : public ECS::System {
 public:
 	std::vector<Pickup*> pickups;
+	PickupSystem();
 	void update(float ms) override;
+	// Takes the pickup over, culling it once it falls off screen
+	void add(Pickup* pickup);
 	std::vector<Pickup*> *getPickups();
 	void clear();
 };
@@ -3,49 +3,86 @@
 //
 
 #include <Engine/GameEngine.hpp>
+#include <Components/MotionComponent.hpp>
+#include <Components/CullBoundsComponent.hpp>
+#include <Components/LifetimeComponent.hpp>
 #include <Components/PlayerComponent.hpp>
 #include <Components/HealthComponent.hpp>
 #include <Components/EnemyComponent.hpp>
 #include <Entities/Projectiles and Damaging/Projectile.hpp>
 #include "ProjectileSystem.hpp"
 
-void ProjectileSystem::update(float ms) {
+namespace {
+    // Bullets that somehow never leave the screen are dropped after this long
+    const float PROJECTILE_LIFETIME = 10000.f;
+}
 
-    // Get screen size
-    int w, h;
-    glfwGetFramebufferSize(GameEngine::getInstance().getM_window(), &w, &h);
-    vec2 screen = { (float)w / GameEngine::getInstance().getM_screen_scale(), (float)h / GameEngine::getInstance().getM_screen_scale() };
-
-    // Update bullets, removing out of screen bullets
-    auto projectile_it = friendly_projectiles.begin();
-    while(projectile_it != friendly_projectiles.end()) {
-        if ((*projectile_it)->isOffScreen(screen))
-        {
-            (*projectile_it)->destroy();
-            projectile_it = friendly_projectiles.erase(projectile_it);
-            continue;
-        } else {
-            (*projectile_it)->update(ms);
-        }
+void ProjectileSystem::Pool::add(Projectile* projectile) {
+    vec2 position = projectile->get_position();
+    vec2 velocity = projectile->get_velocity();
+    projectiles.push_back(projectile);
+    x.push_back(position.x);
+    y.push_back(position.y);
+    vx.push_back(velocity.x / 1000);
+    vy.push_back(velocity.y / 1000);
+}
+
+void ProjectileSystem::Pool::remove(std::size_t i) {
+    std::size_t last = projectiles.size() - 1;
+    projectiles[i] = projectiles[last];
+    x[i] = x[last];
+    y[i] = y[last];
+    vx[i] = vx[last];
+    vy[i] = vy[last];
+
+    projectiles.pop_back();
+    x.pop_back();
+    y.pop_back();
+    vx.pop_back();
+    vy.pop_back();
+}
 
-        ++projectile_it;
+void ProjectileSystem::Pool::clear() {
+    for (auto* projectile : projectiles)
+        projectile->destroy();
+    projectiles.clear();
+    x.clear();
+    y.clear();
+    vx.clear();
+    vy.clear();
+}
+
+void ProjectileSystem::advance(Pool& pool, float ms) {
+    std::size_t count = pool.size();
+    float* x = pool.x.data();
+    float* y = pool.y.data();
+    const float* vx = pool.vx.data();
+    const float* vy = pool.vy.data();
+    for (std::size_t i = 0; i < count; ++i) {
+        x[i] += vx[i] * ms;
+        y[i] += vy[i] * ms;
     }
 
-    // Update bullets, removing out of screen bullets
-    projectile_it = hostile_projectiles.begin();
-    while(projectile_it != hostile_projectiles.end()) {
-        if ((*projectile_it)->isOffScreen(screen))
-        {
-            (*projectile_it)->destroy();
-            projectile_it = hostile_projectiles.erase(projectile_it);
-            continue;
-        } else {
-            (*projectile_it)->update(ms);
-        }
+    for (std::size_t i = 0; i < count; ++i)
+        pool.projectiles[i]->getComponent<MotionComponent>()->position = { x[i], y[i] };
+}
 
-        ++projectile_it;
+ProjectileSystem::ProjectileSystem() {
+    writing<MotionComponent>();
+}
+
+void ProjectileSystem::update(float ms) {
+    // Drops the bullets CullingSystem destroyed
+    removeDestroyed();
+
+    for (auto* projectile : queued) {
+        if (projectile->isActive())
+            (projectile->isHostile() ? hostile : friendly).add(projectile);
     }
+    queued.clear();
 
+    advance(friendly, ms);
+    advance(hostile, ms);
 
     /* This was me playing around with an actual full on projectile ECS system, but it would require a lot of refactoring to work... so nevermind
     std::vector<Projectile*> hostile_projectiles;
@@ -87,13 +124,25 @@ void ProjectileSystem::update(float ms) {
      */
 }
 
-void ProjectileSystem::clear() {
-    for (auto* projectile : friendly_projectiles) {
-        projectile->destroy();
+void ProjectileSystem::spawn(Projectile* projectile) {
+    projectile->addComponent<CullBoundsComponent>(projectile->get_bounding_box(), PROJECTILE_CULL_MARGIN);
+    projectile->addComponent<LifetimeComponent>(PROJECTILE_LIFETIME);
+    queued.push_back(projectile);
+}
+
+void ProjectileSystem::removeDestroyed() {
+    for (auto* pool : { &friendly, &hostile }) {
+        for (std::size_t i = pool->size(); i-- > 0;) {
+            if (!pool->projectiles[i]->isActive())
+                pool->remove(i);
+        }
     }
-    friendly_projectiles.clear();
-    for (auto* projectile : hostile_projectiles) {
+}
+
+void ProjectileSystem::clear() {
+    friendly.clear();
+    hostile.clear();
+    for (auto* projectile : queued)
         projectile->destroy();
-    }
-    hostile_projectiles.clear();
+    queued.clear();
 }
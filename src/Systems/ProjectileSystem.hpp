@@ -6,16 +6,47 @@
 #define VAPE_PROJECTILESYSTEM_HPP
 
 
+#include <vector>
 #include <Engine/ECS/System.hpp>
 #include <Entities/Projectiles and Damaging/Projectile.hpp>
 
 class Projectile;
 
+// Owns and moves the bullets fired by weapons and enemies. Each side's bullets are a pool of SoA records,
+// velocities are worked out once when a bullet joins so updating is a multiply-add over arrays, and
+// removing a bullet moves the last record into its slot.
+// spawn() only queues, queued bullets join their pool at the start of the next update. Bullets are culled by
+// CullingSystem, which has to run first.
 class ProjectileSystem : public ECS::System {
+private:
+    struct Pool {
+        std::vector<Projectile*> projectiles;
+        std::vector<float> x, y;
+        std::vector<float> vx, vy; // px/ms
+
+        std::size_t size() const { return projectiles.size(); }
+        void add(Projectile* projectile);
+        void remove(std::size_t i);
+        void clear();
+    };
+
+    Pool friendly;
+    Pool hostile;
+    std::vector<Projectile*> queued;
+
+    void advance(Pool& pool, float ms);
 public:
-    std::vector<Projectile*> friendly_projectiles;
-    std::vector<Projectile*> hostile_projectiles;
+    ProjectileSystem();
     void update(float ms) override;
+
+    // Adds the bullet at the next update, it's then moved until it's destroyed, at the latest once off screen or expired
+    void spawn(Projectile* projectile);
+
+    const std::vector<Projectile*>& getFriendlyProjectiles() const { return friendly.projectiles; }
+    const std::vector<Projectile*>& getHostileProjectiles() const { return hostile.projectiles; }
+
+    // Drops destroyed bullets, must be called after destroying any before the next entity manager update
+    void removeDestroyed();
     void clear();
 };
 